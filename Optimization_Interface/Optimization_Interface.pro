@@ -26,16 +26,26 @@ DEFINES += QT_DEPRECATED_WARNINGS
 #MIKIPILOT = $$PWD/../../../mikipilot
 
 
-INCLUDEPATH += $$PWD/../../skyenet/algorithm/
-INCLUDEPATH += $$PWD/../../skyenet/cprs/headers/
-INCLUDEPATH += $$PWD/../../skyenet/csocp/
 INCLUDEPATH += $$PWD/../../mikipilot
 INCLUDEPATH += $$PWD/../../mikipilot/build/gcs/executable/
 
-# //SKYENET//
-LIBS += -L$$PWD/../../skyenet/algorithm -lalgorithm # looks for libalgorithm.a file
-LIBS += -L$$PWD/../../skyenet/cprs/build -lCPRS     # looks for libCPRS.a
-LIBS += -L$$PWD/../../skyenet/csocp -lCSOCP         # looks for libCSOCP.a
+# build without skyenet, solving with the reference solver only:
+#   qmake CONFIG+=reference_solver_only
+reference_solver_only {
+    DEFINES += REFERENCE_SOLVER_ONLY
+} else {
+    INCLUDEPATH += $$PWD/../../skyenet/algorithm/
+    INCLUDEPATH += $$PWD/../../skyenet/cprs/headers/
+    INCLUDEPATH += $$PWD/../../skyenet/csocp/
+
+    # //SKYENET//
+    LIBS += -L$$PWD/../../skyenet/algorithm -lalgorithm # looks for libalgorithm.a file
+    LIBS += -L$$PWD/../../skyenet/cprs/build -lCPRS     # looks for libCPRS.a
+    LIBS += -L$$PWD/../../skyenet/csocp -lCSOCP         # looks for libCSOCP.a
+
+    SOURCES += src/solvers/skyefly_solver.cpp
+    HEADERS += include/solvers/skyefly_solver.h
+}
 
 # //MIKIPILOT//
 LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/ -l_autogen_globals     # looks for lib_autogen_globals.a
@@ -49,7 +59,11 @@ LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/ -l_utilities           # l
 LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/ -l_gnc                 # looks for lib_gnc.a
 
 SOURCES += \
-    src/controls/compute_thread.cpp \
+    src/controls/drone_planner.cpp \
+    src/controls/replan_scheduler.cpp \
+    src/controls/planner_stats.cpp \
+    src/solvers/trajectory_solver.cpp \
+    src/solvers/reference_solver.cpp \
     src/controls/controller.cpp \
     src/graphics/plane_resize_handle.cpp \
     src/graphics/waypoint_graphics_item.cpp \
@@ -57,10 +71,14 @@ SOURCES += \
     src/network/waypoint_socket.cpp \
     src/window/main_window.cpp \
     src/graphics/canvas.cpp \
+    src/graphics/background_tiles.cpp \
+    src/graphics/basemap_file.cpp \
+    src/graphics/render_scheduler.cpp \
     src/graphics/view.cpp \
     src/window/menu_panel.cpp \
     src/window/menu_button.cpp \
     src/models/constraint_model.cpp \
+    src/models/scene_snapshot.cpp \
     src/globals.cpp \
     src/graphics/ellipse_graphics_item.cpp \
     src/graphics/ellipse_resize_handle.cpp \
@@ -69,21 +87,34 @@ SOURCES += \
     src/graphics/plane_graphics_item.cpp \
     src/graphics/drone_graphics_item.cpp \
     src/graphics/path_graphics_item.cpp \
+    src/graphics/path_history_graphics_item.cpp \
     src/window/port_dialog.cpp \
     src/window/port_dialog/drone_id_selector.cpp \
     src/window/port_dialog/port_selector.cpp \
     src/network/drone_socket.cpp \
+    src/network/network_thread.cpp \
+    src/network/datagram_batch.cpp \
+    src/network/telemetry_mux.cpp \
+    src/network/telemetry_socket.cpp \
     src/network/ellipse_socket.cpp \
     src/graphics/point_graphics_item.cpp \
     src/network/point_socket.cpp
 
 HEADERS += \
-    include/controls/compute_thread.h \
+    include/controls/drone_planner.h \
+    include/controls/replan_scheduler.h \
+    include/controls/planner_stats.h \
+    include/solvers/trajectory_solver.h \
+    include/solvers/trajectory_problem.h \
+    include/solvers/reference_solver.h \
     include/graphics/plane_resize_handle.h \
     include/graphics/waypoint_graphics_item.h \
     include/network/waypoint_socket.h \
     include/window/main_window.h \
     include/graphics/canvas.h \
+    include/graphics/background_tiles.h \
+    include/graphics/basemap_file.h \
+    include/graphics/render_scheduler.h \
     include/graphics/view.h \
     include/window/menu_panel.h \
     include/window/menu_button.h \
@@ -100,16 +131,25 @@ HEADERS += \
     include/graphics/plane_graphics_item.h \
     include/graphics/drone_graphics_item.h \
     include/models/path_model_item.h \
+    include/models/path_history_model_item.h \
     include/models/drone_model_item.h \
     include/graphics/path_graphics_item.h \
+    include/graphics/path_history_graphics_item.h \
     include/window/port_dialog.h \
     include/window/port_dialog/drone_id_selector.h \
     include/window/port_dialog/port_selector.h \
     include/models/data_model.h \
+    include/models/change_notifier.h \
+    include/models/params_cache.h \
+    include/models/scene_snapshot.h \
     include/network/ellipse_socket.h \
     include/models/point_model_item.h \
     include/graphics/point_graphics_item.h \
     include/network/drone_socket.h \
+    include/network/network_thread.h \
+    include/network/datagram_batch.h \
+    include/network/telemetry_mux.h \
+    include/network/telemetry_socket.h \
     include/network/point_socket.h
 
 RESOURCES += \
@@ -0,0 +1,87 @@
+#-------------------------------------------------
+#
+# Headless batch planner sharing the model and
+# solver code of Optimization_Interface
+#
+#-------------------------------------------------
+
+# widgets linked for model helpers only, no display is opened
+QT       += core gui widgets
+
+TARGET = Optimization_Interface_Headless
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+# sources included relative to Optimization_Interface
+OPTGUI = $$PWD/..
+INCLUDEPATH += $$OPTGUI
+
+INCLUDEPATH += $$OPTGUI/../../mikipilot
+INCLUDEPATH += $$OPTGUI/../../mikipilot/build/gcs/executable/
+
+# build without skyenet, solving with the reference solver only:
+#   qmake CONFIG+=reference_solver_only
+reference_solver_only {
+    DEFINES += REFERENCE_SOLVER_ONLY
+} else {
+    INCLUDEPATH += $$OPTGUI/../../skyenet/algorithm/
+    INCLUDEPATH += $$OPTGUI/../../skyenet/cprs/headers/
+    INCLUDEPATH += $$OPTGUI/../../skyenet/csocp/
+
+    # //SKYENET//
+    LIBS += -L$$OPTGUI/../../skyenet/algorithm -lalgorithm # looks for libalgorithm.a file
+    LIBS += -L$$OPTGUI/../../skyenet/cprs/build -lCPRS     # looks for libCPRS.a
+    LIBS += -L$$OPTGUI/../../skyenet/csocp -lCSOCP         # looks for libCSOCP.a
+
+    SOURCES += $$OPTGUI/src/solvers/skyefly_solver.cpp
+    HEADERS += $$OPTGUI/include/solvers/skyefly_solver.h
+}
+
+# //MIKIPILOT//
+LIBS += -L$$OPTGUI/../../mikipilot/build/gcs/executable/ -l_autogen_globals     # looks for lib_autogen_globals.a
+LIBS += -L$$OPTGUI/../../mikipilot/build/gcs/executable/ -l_autogen_packet      # looks for lib_autogen_packet.a
+LIBS += -L$$OPTGUI/../../mikipilot/build/gcs/executable/ -l_autogen_state       # looks for lib_autogen_state.a
+LIBS += -L$$OPTGUI/../../mikipilot/build/gcs/executable/ -l_autogen_parameter   # looks for lib_autogen_parameter.a
+LIBS += -L$$OPTGUI/../../mikipilot/build/gcs/executable/ -l_autogen_timestamped # looks for lib_autogen_timestamped.a
+LIBS += -L$$OPTGUI/../../mikipilot/build/gcs/executable/ -l_autogen_bus         # looks for lib_autogen_bus.a
+LIBS += -L$$OPTGUI/../../mikipilot/build/gcs/executable/ -l_network             # looks for lib_network.a
+LIBS += -L$$OPTGUI/../../mikipilot/build/gcs/executable/ -l_utilities           # looks for lib_utilities.a
+LIBS += -L$$OPTGUI/../../mikipilot/build/gcs/executable/ -l_gnc                 # looks for lib_gnc.a
+
+SOURCES += \
+    $$OPTGUI/src/headless/main.cpp \
+    $$OPTGUI/src/headless/batch_planner.cpp \
+    $$OPTGUI/src/headless/batch_scene.cpp \
+    $$OPTGUI/src/solvers/trajectory_solver.cpp \
+    $$OPTGUI/src/solvers/reference_solver.cpp \
+    $$OPTGUI/src/graphics/basemap_file.cpp \
+    $$OPTGUI/src/models/constraint_model.cpp \
+    $$OPTGUI/src/models/scene_snapshot.cpp \
+    $$OPTGUI/src/window/port_dialog/drone_id_selector.cpp \
+    $$OPTGUI/src/window/port_dialog/port_selector.cpp \
+    $$OPTGUI/src/globals.cpp
+
+HEADERS += \
+    $$OPTGUI/include/headless/batch_planner.h \
+    $$OPTGUI/include/headless/batch_scene.h \
+    $$OPTGUI/include/solvers/trajectory_solver.h \
+    $$OPTGUI/include/solvers/trajectory_problem.h \
+    $$OPTGUI/include/solvers/reference_solver.h \
+    $$OPTGUI/include/graphics/basemap_file.h \
+    $$OPTGUI/include/models/constraint_model.h \
+    $$OPTGUI/include/models/scene_snapshot.h \
+    $$OPTGUI/include/models/params_cache.h \
+    $$OPTGUI/include/models/change_notifier.h \
+    $$OPTGUI/include/models/data_model.h \
+    $$OPTGUI/include/models/ellipse_model_item.h \
+    $$OPTGUI/include/models/polygon_model_item.h \
+    $$OPTGUI/include/models/plane_model_item.h \
+    $$OPTGUI/include/models/point_model_item.h \
+    $$OPTGUI/include/models/path_model_item.h \
+    $$OPTGUI/include/models/drone_model_item.h \
+    $$OPTGUI/include/window/port_dialog/drone_id_selector.h \
+    $$OPTGUI/include/window/port_dialog/port_selector.h \
+    $$OPTGUI/include/globals.h
@@ -8,8 +8,6 @@
 #ifndef CONTROLLER_H_
 #define CONTROLLER_H_
 
-#include <cprs.h>
-#include <algorithm.h>
 #include <QTimer>
 #include <QFile>
 #include <QTableWidget>
@@ -21,7 +19,10 @@
 #include "include/network/ellipse_socket.h"
 #include "include/network/waypoint_socket.h"
 #include "include/network/point_socket.h"
-#include "include/controls/compute_thread.h"
+#include "include/network/network_thread.h"
+#include "include/network/telemetry_mux.h"
+#include "include/controls/drone_planner.h"
+#include "include/controls/replan_scheduler.h"
 
 namespace optgui {
 
@@ -32,8 +33,8 @@ class Controller : public QObject {
     explicit Controller(Canvas *canvas);
     ~Controller();
 
-    // SkyFly compute thread
-    QMap<DroneModelItem *, ComputeThread *> compute_threads_;
+    // SkyFly planner for each drone
+    QMap<DroneModelItem *, DronePlanner *> planners_;
 
     // add constraints
     void addEllipse(QPointF const &point, qreal radius = 120);
@@ -72,32 +73,46 @@ class Controller : public QObject {
     void setSimulated(bool state);
     void setTrajLock(bool state);
     void setFreeFinalTime(bool state);
+    void setWarmStart(bool state);
+    void setSolverBackend(SOLVER_BACKEND backend);
     void setDataCapture(bool state);
 
     // pass info between model and view
     quint32 getNumWaypoints();
     void setClearance(qreal clearance);
+    void setMaxReplanRate(qreal rate);
     void setCurrFinalPoint(PointModelItem *point);
     void setCurrDrone(DroneModelItem *drone);
     FEASIBILITY_CODE getIsValidTraj();
     INPUT_CODE getIsValidInput();
+    // stage latencies and solver counters for current drone
+    PlannerStats getCurrPlannerStats();
+    // telemetry ingest counters for current drone
+    TelemetryStats getCurrTelemetryStats();
+    // write stats for all drones to csv file,
+    // return file name or empty string if not written
+    QString dumpPlannerStats();
 
  signals:
-    void trajectoryExecuted(DroneModelItem *, autogen::packet::traj3dof data);
+    void trajectoryExecuted(DroneModelItem *, Traj3dofPtr data);
     // signal view to update
     void finalTime(qreal time);
     void updateMessage();
+    void updateStats();
 
  private slots:
     // receive update from compute thread, check if
     // drone is current drone
     void updateMessage(DroneModelItem *drone);
+    void updateStats(DroneModelItem *drone);
     void finalTime(DroneModelItem *drone, qreal time);
     void startSockets();
     void tickLiveReference();
 
  private:
     ConstraintModel *model_;
+    // computes trajs for all planners on shared threads
+    ReplanScheduler *scheduler_;
 
     // QGraphicsScene
     Canvas *canvas_;
@@ -105,10 +120,13 @@ class Controller : public QObject {
     qreal final_point_render_level_;
     qreal waypoints_render_level_;
     qreal traj_render_level_;
+    qreal history_render_level_;
 
     // flag for simulated traj
     bool is_simulated_;
     bool traj_lock_;
+    // send staged traj to drone sockets
+    void sendStagedTraj(DroneModelItem *staged_drone);
 
     // Data capture
     bool capture_data_;
@@ -123,11 +141,19 @@ class Controller : public QObject {
 
     // network configuration dialog box
     PortDialog *port_dialog_;
+    // thread sockets read and decode packets on
+    NetworkThread *network_thread_;
+    // shared telemetry port in single port mode, null otherwise
+    TelemetryMux *telemetry_mux_;
     QVector<DroneSocket *> drone_sockets_;
     QVector<PointSocket *> final_point_sockets_;
     QVector<WaypointSocket *> waypoint_sockets_;
     QVector<EllipseSocket *> ellipse_sockets_;
 
+    // read packets for object on its port, or route them
+    // from telemetry mux in single port mode
+    void addTelemetrySocket(TelemetrySocket *socket, quint16 port);
+    void removeTelemetrySocket(TelemetrySocket *socket);
     // remove items
     void removeDroneSocket(DroneModelItem *model);
     void removeEllipseSocket(EllipseModelItem *model);
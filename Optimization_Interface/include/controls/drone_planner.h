@@ -0,0 +1,138 @@
+// TITLE:   Optimization_Interface/include/controls/drone_planner.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Skyfly problem state for one drone, solved on replan scheduler threads
+
+#ifndef DRONE_PLANNER_H_
+#define DRONE_PLANNER_H_
+
+#include <QObject>
+#include <QMutex>
+#include <QElapsedTimer>
+
+#include <memory>
+
+#include "include/solvers/trajectory_solver.h"
+#include "include/controls/planner_stats.h"
+#include "include/models/constraint_model.h"
+#include "include/models/path_history_model_item.h"
+#include "include/graphics/path_graphics_item.h"
+#include "include/graphics/drone_graphics_item.h"
+#include "include/globals.h"
+
+namespace optgui {
+
+class DronePlanner : public QObject {
+    Q_OBJECT
+
+ public:
+    explicit DronePlanner(ConstraintModel *model,
+                          DroneGraphicsItem *drone,
+                          PathGraphicsItem *traj_graphic);
+    ~DronePlanner();
+
+    PathGraphicsItem *getTrajGraphic();
+    void setTarget(PointModelItem *target);
+    void reInit();
+    PointModelItem *getTarget();
+    void stopCompute();
+    DroneGraphicsItem *getDroneGraphic();
+    DroneModelItem *getDrone();
+    // past trajs computed by this planner
+    PathHistoryModelItem *getHistory();
+
+    // whether inputs changed since last computed traj
+    bool needsReplan();
+    // msecs until replan rate allows a new traj, 0 if ready
+    qint64 msecsUntilReady(qreal max_rate);
+    // compute new traj from current model,
+    // called by one scheduler thread at a time
+    void computeTraj();
+    // get copy of stage latencies and solver counters
+    PlannerStats getPlannerStats();
+
+ // slots for signals from planner are run in parent thread
+ signals:
+    void updateGraphics(PathGraphicsItem *traj_graphic,
+                        DroneGraphicsItem *drone_graphic);
+    void updateMessage(DroneModelItem *drone);
+    void updateEllipseColors();
+    void finalTime(DroneModelItem *drone, double final_time);
+    // emitted after replan is recorded in planner stats
+    void updateStats(DroneModelItem *drone);
+
+ private:
+    // GUI data
+    ConstraintModel *model_;
+    // problem data, solver recreated when backend changes
+    std::unique_ptr<TrajectorySolver> solver_;
+    SOLVER_BACKEND backend_;
+    // params kept between computes, constraint slots only
+    // rebuilt for items that changed
+    TrajectoryProblem params_;
+    ParamsCache params_cache_;
+
+    // vehicle and target
+    DroneGraphicsItem *drone_;
+    PointModelItem *target_;
+    PathGraphicsItem *traj_graphic_;
+    // ring of computed trajs, fixed size so recording
+    // does not allocate once warmed up
+    PathHistoryModelItem history_;
+
+    // compute traj flag
+    bool run_loop_;
+
+    // lock for accessing resources shared by scheduler threads and
+    // controller (target, run flag and last computed inputs)
+    QMutex mutex_;
+
+    // flag to reset inputs
+    bool target_changed_;
+
+    // generations of inputs used for last computed traj,
+    // skip compute if none of them changed
+    quint64 scene_revision_;
+    quint64 drone_generation_;
+    quint64 target_generation_;
+    PointModelItem *computed_target_;
+    // time since last computed traj, for limiting replan rate
+    QElapsedTimer replan_timer_;
+
+    // last computed traj in xyz meters and its times,
+    // only used by computing thread
+    QVector<QVector3D> warm_traj_;
+    QVector<qreal> warm_times_;
+    // last computed traj in GUI coords, copied into traj graphic
+    // and history so buffer is never shared
+    QVector<QPointF> trajectory_;
+    // rest of last traj passed to solver, reused between computes
+    TrajectorySeed seed_;
+    PlannerStats planner_stats_;
+
+    INPUT_CODE validateInputs(QVector<QRegion> const &ellipse_regions,
+                              QVector3D const &initial_pos,
+                              QVector3D const &final_pos);
+    void setFeasibilityColor(bool is_feasible);
+
+    // find time along previous traj closest to drone,
+    // return false if drone is too far from it to warm start
+    bool findWarmStartShift(QVector3D const &xyz_pos, qreal *time_shift);
+    // load seed with previous traj after time shift
+    void loadSeed(qreal time_shift);
+    void recordReplan(qint64 const stage_nsecs[NUM_PLAN_STAGES],
+                      bool is_feasible, quint32 iterations,
+                      bool warm_start);
+
+    // whether inputs differ from last computed traj,
+    // caller must hold mutex
+    bool inputsChanged(SceneSnapshot const &scene);
+
+    bool getRunFlag();
+};
+
+}  // namespace optgui
+
+#endif  // DRONE_PLANNER_H_
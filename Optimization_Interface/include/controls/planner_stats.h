@@ -0,0 +1,94 @@
+// TITLE:   Optimization_Interface/include/controls/planner_stats.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Latency histograms and solver counters for one drone planner
+
+#ifndef PLANNER_STATS_H_
+#define PLANNER_STATS_H_
+
+#include <QVector>
+#include <QQueue>
+#include <QString>
+#include <QElapsedTimer>
+
+namespace optgui {
+
+// Stages of one replan, timed separately
+enum PLAN_STAGE {
+    VALIDATE_STAGE,
+    PARAMS_STAGE,
+    SOLVE_STAGE,
+    CONVERT_STAGE,
+    PUBLISH_STAGE,
+    NUM_PLAN_STAGES
+};
+
+// Log spaced histogram of durations with fixed memory,
+// eight buckets per doubling from 1 us to about a minute
+class LatencyHistogram {
+ public:
+    LatencyHistogram();
+
+    void record(qint64 nsecs);
+    // upper bound in nsecs of bucket holding given fraction
+    // of samples, 0 if empty
+    qint64 percentile(qreal fraction) const;
+    quint64 getCount() const;
+
+ private:
+    QVector<quint64> buckets_;
+    quint64 count_;
+};
+
+class PlannerStats {
+ public:
+    PlannerStats();
+
+    // record one published replan, iterations 0 if
+    // solver does not report them
+    void recordReplan(qint64 const stage_nsecs[NUM_PLAN_STAGES],
+                      bool is_feasible, quint32 iterations,
+                      bool warm_start);
+
+    LatencyHistogram const &getStage(PLAN_STAGE stage) const;
+    // latency of whole replan
+    LatencyHistogram const &getTotal() const;
+    quint64 getReplans() const;
+    // replans in last second
+    qreal getReplanRate() const;
+    // fraction of replans with infeasible trajs
+    qreal getInfeasibleRate() const;
+    // mean solver iterations of replans reporting them
+    qreal getMeanIterations() const;
+    // solve stage latency of replans seeded from previous traj
+    // and of replans starting from initial guess
+    LatencyHistogram const &getWarmSolve() const;
+    LatencyHistogram const &getColdSolve() const;
+    // mean iterations of cold starts less mean of warm starts,
+    // 0 until both have reported iterations
+    qreal getIterationsSaved() const;
+
+    static QString getStageName(PLAN_STAGE stage);
+
+ private:
+    LatencyHistogram stages_[NUM_PLAN_STAGES];
+    LatencyHistogram total_;
+    LatencyHistogram warm_solve_;
+    LatencyHistogram cold_solve_;
+
+    quint64 infeasible_;
+    quint64 iterations_;
+    quint64 iteration_replans_;
+    quint64 warm_iterations_;
+    quint64 warm_iteration_replans_;
+
+    // times of replans in last second for replan rate
+    QElapsedTimer clock_;
+    QQueue<qint64> recent_msecs_;
+};
+
+}  // namespace optgui
+
+#endif  // PLANNER_STATS_H_
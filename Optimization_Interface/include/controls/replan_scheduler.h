@@ -0,0 +1,71 @@
+// TITLE:   Optimization_Interface/include/controls/replan_scheduler.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Thread dispatching drone replans to a shared pool sized to the hardware
+
+#ifndef REPLAN_SCHEDULER_H_
+#define REPLAN_SCHEDULER_H_
+
+#include <QThread>
+#include <QThreadPool>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QSet>
+
+#include "include/models/constraint_model.h"
+#include "include/controls/drone_planner.h"
+
+namespace optgui {
+
+class ReplanJob;
+
+class ReplanScheduler : public QThread {
+    Q_OBJECT
+
+ public:
+    explicit ReplanScheduler(ConstraintModel *model);
+    ~ReplanScheduler();
+
+    // schedule replans for planner until removed
+    void addPlanner(DronePlanner *planner);
+    // stop planner and block until its running compute finishes,
+    // caller responsible for deleting planner
+    void removePlanner(DronePlanner *planner);
+    // stop dispatching and wait for running computes
+    void stopScheduler();
+
+ protected:
+    void run() override;
+
+ private:
+    friend class ReplanJob;
+
+    ConstraintModel *model_;
+    // worker threads shared by all drones
+    QThreadPool pool_;
+
+    // lock for planners and pending jobs
+    QMutex mutex_;
+    // wakes removePlanner when a job finishes
+    QWaitCondition job_finished_;
+    QSet<DronePlanner *> planners_;
+    // planners with a job queued or running, at most one each
+    QSet<DronePlanner *> pending_;
+
+    // dispatch loop flag
+    bool run_loop_;
+
+    // submit jobs for planners with changed inputs, return msecs
+    // until next rate limited planner is ready, -1 if none
+    qint64 dispatch();
+    // called on worker thread when planner compute finishes
+    void finishJob(DronePlanner *planner);
+
+    bool getRunFlag();
+};
+
+}  // namespace optgui
+
+#endif  // REPLAN_SCHEDULER_H_
@@ -10,10 +10,30 @@
 
 #include <QGraphicsItem>
 #include <QVector3D>
+#include <QString>
 
 namespace optgui {
     extern qreal const GRID_SIZE;  // scale from meters to pixels
     extern qreal const INIT_CLEARANCE;  // clearance around obs in meters
+    // max drone distance from last traj in meters to warm start from it
+    extern qreal const WARM_START_TOLERANCE;
+    // max sum of squared solver violations for a feasible traj
+    extern qreal const FEASIBILITY_TOLERANCE;
+    // height in view pixels of meter scale drawn in bottom corner
+    extern qint32 const SCALE_BAR_HEIGHT;
+    // default cap on graphics flushes per second
+    extern qreal const INIT_MAX_FRAME_RATE;
+    // file suffix of tiled basemaps
+    extern QString const BASEMAP_SUFFIX;
+    // zoom below which constraints are drawn without border shading,
+    // clearance rings or labels
+    extern qreal const LOD_DETAIL_SCALE;
+    // view pixels between trajectory points kept for drawing
+    extern qreal const LOD_PATH_TOLERANCE;
+    // past trajectories kept per drone for scrubbing back
+    extern qint32 const TRAJ_HISTORY_SIZE;
+    // default port receiving all telemetry in single port mode
+    extern quint16 const INIT_MUX_PORT;
 
     // Color scheme constants
     extern QColor const RED;
@@ -55,6 +75,12 @@ namespace optgui {
         INFEASIBLE
     };
 
+    // Trajectory solver backends
+    enum SOLVER_BACKEND {
+        SKYEFLY_SOLVER,
+        REFERENCE_SOLVER
+    };
+
     // Input validation
     enum INPUT_CODE {
         VALID_INPUT,
@@ -0,0 +1,69 @@
+// TITLE:   Optimization_Interface/include/graphics/background_tiles.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Mipmapped tile pyramid of background image or streamed basemap
+
+#ifndef BACKGROUND_TILES_H_
+#define BACKGROUND_TILES_H_
+
+#include <QImage>
+#include <QPixmap>
+#include <QPainter>
+#include <QRectF>
+#include <QVector>
+#include <QCache>
+
+#include <memory>
+
+#include "include/graphics/basemap_file.h"
+
+namespace optgui {
+
+// Background image scaled down by halves and cut into tiles once,
+// so repaints only blit visible tiles near screen resolution
+// instead of rescaling the whole image. Tiles of a basemap file are
+// decoded when first drawn and kept in a least recently used cache
+class BackgroundTiles {
+ public:
+    BackgroundTiles();
+
+    // build pyramid of image placed at bbox in scene coords
+    void setImage(QImage const &image, QRectF const &bbox);
+    // stream tiles from opened basemap placed at bbox in scene coords
+    void setBasemap(std::unique_ptr<BasemapFile> basemap,
+                    QRectF const &bbox);
+    bool isEmpty() const;
+
+    // draw tiles intersecting exposed scene rect at the smallest
+    // level not below screen resolution for view scale
+    void draw(QPainter *painter, QRectF const &exposed, qreal scale) const;
+
+ private:
+    // one level of pyramid, tiles stored row major,
+    // no tiles stored when streaming basemap
+    struct Level {
+        qint32 width;
+        qint32 height;
+        qint32 cols;
+        qint32 rows;
+        QVector<QPixmap> tiles;
+    };
+
+    QVector<Level> levels_;
+    QRectF bbox_;
+
+    // streamed basemap and its decoded tiles, cost in KB
+    std::unique_ptr<BasemapFile> basemap_;
+    mutable QCache<quint64, QPixmap> basemap_cache_;
+
+    // index of level to draw for view scale
+    qint32 getLevel(qreal scale) const;
+    // stored or decoded tile, null if it could not be decoded
+    QPixmap getTile(qint32 level, qint32 col, qint32 row) const;
+};
+
+}  // namespace optgui
+
+#endif  // BACKGROUND_TILES_H_
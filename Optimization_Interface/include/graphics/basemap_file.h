@@ -0,0 +1,101 @@
+// TITLE:   Optimization_Interface/include/graphics/basemap_file.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Memory mapped file of encoded background tiles
+
+#ifndef BASEMAP_FILE_H_
+#define BASEMAP_FILE_H_
+
+#include <QFile>
+#include <QImage>
+#include <QPointF>
+#include <QSize>
+#include <QString>
+#include <QVector>
+
+namespace optgui {
+
+// Tiled basemap on disk. Layout, little endian:
+//   header: magic, version, tile size, number of levels (quint32),
+//           bottom left x, y and top right x, y in meters (double),
+//           offset of index (quint64)
+//   encoded tiles, any format QImage reads
+//   index: per level width, height, cols, rows (quint32),
+//          then per tile in row major order offset (quint64)
+//          and length (quint32)
+// Level 0 is full resolution, each level after is half size.
+// File is mapped, not read, so only touched tiles are paged in
+class BasemapFile {
+ public:
+    BasemapFile();
+    ~BasemapFile();
+
+    bool open(QString const &filename);
+    void close();
+    bool isOpen() const;
+
+    // geo bounds in meters, ordered like background image filenames
+    QPointF getBottomLeft() const;
+    QPointF getTopRight() const;
+
+    qint32 getTileSize() const;
+    qint32 getNumLevels() const;
+    // size of level in pixels
+    QSize getLevelSize(qint32 level) const;
+    // decode one tile from mapped file, null image if out of range
+    QImage readTile(qint32 level, qint32 col, qint32 row) const;
+
+    // cut image into tile pyramid and write basemap file,
+    // tiles encoded in given image format
+    static bool write(QImage const &image, QPointF const &bottom_left,
+                      QPointF const &top_right, QString const &filename,
+                      char const *format = "PNG");
+    // same as above, decoding image file one tile at a time so
+    // images too large for one QImage can be converted. Formats
+    // that cannot decode part of an image, like PNG, are decoded
+    // whole and limited to what one QImage can hold
+    static bool write(QString const &image_file,
+                      QPointF const &bottom_left,
+                      QPointF const &top_right, QString const &filename,
+                      char const *format = "PNG");
+
+ private:
+    // tile locations of one level
+    struct LevelIndex {
+        qint32 width;
+        qint32 height;
+        qint32 cols;
+        qint32 rows;
+        QVector<quint64> offsets;
+        QVector<quint32> lengths;
+    };
+
+    // helpers for writing, level 0 tiles are appended by caller
+    // and each level after is built from tiles of the one before,
+    // so no more than four tiles are decoded at a time
+    static bool writeHeader(QFile *file, QPointF const &bottom_left,
+                            QPointF const &top_right);
+    static LevelIndex makeLevel(qint32 width, qint32 height);
+    // encode tile at end of file and add it to level index
+    static bool appendTile(QFile *file, QImage const &tile,
+                           char const *format, LevelIndex *level);
+    // add halved levels until one tile holds level,
+    // then write index and patch header
+    static bool finishFile(QFile *file, char const *format,
+                           QVector<LevelIndex> *levels);
+
+    QFile file_;
+    uchar *data_;
+    qint64 size_;
+
+    qint32 tile_size_;
+    QPointF bottom_left_;
+    QPointF top_right_;
+    QVector<LevelIndex> levels_;
+};
+
+}  // namespace optgui
+
+#endif  // BASEMAP_FILE_H_
@@ -12,12 +12,15 @@
 #include <QFont>
 
 #include "include/graphics/path_graphics_item.h"
+#include "include/graphics/path_history_graphics_item.h"
 #include "include/graphics/drone_graphics_item.h"
 #include "include/graphics/waypoint_graphics_item.h"
 #include "include/graphics/point_graphics_item.h"
 #include "include/graphics/ellipse_graphics_item.h"
 #include "include/graphics/polygon_graphics_item.h"
 #include "include/graphics/plane_graphics_item.h"
+#include "include/graphics/render_scheduler.h"
+#include "include/graphics/background_tiles.h"
 
 namespace optgui {
 
@@ -31,8 +34,24 @@ class Canvas : public QGraphicsScene {
     // render item at top level
     void bringToFront(QGraphicsItem *item);
 
+    // index items in a bsp tree and only repaint dirty regions,
+    // otherwise repaint every item on each refresh
+    void setPartialUpdates(bool enabled);
+    bool getPartialUpdates();
+
+    // zoom level of view, passed on to items so they rescale
+    // pens and bounds once per zoom instead of every paint
+    void setScalingFactor(qreal scaling_factor);
+    qreal getScalingFactor() const;
+
+    // replans back to highlight in traj history overlays,
+    // 0 hides overlays
+    void setHistoryAge(qint32 age);
+    qint32 getHistoryAge() const;
+
     QSet<PathGraphicsItem *> path_graphics_;
     PathGraphicsItem *path_staged_graphic_;
+    QSet<PathHistoryGraphicsItem *> history_graphics_;
 
     QSet<DroneGraphicsItem *> drone_graphics_;
     QSet<EllipseGraphicsItem *> ellipse_graphics_;
@@ -41,6 +60,9 @@ class Canvas : public QGraphicsScene {
     QSet<PointGraphicsItem *> final_points_;
     QVector<WaypointGraphicsItem *> waypoint_graphics_;
 
+    // coalesces graphics updates into render frames
+    RenderScheduler *render_scheduler_;
+
  protected:
     // draw foreground and background
     void drawBackground(QPainter *painter, const QRectF &rect) override;
@@ -52,10 +74,18 @@ class Canvas : public QGraphicsScene {
 
     // manually force a re-render of item
     void updateGraphicsItems(PathGraphicsItem *, DroneGraphicsItem *);
+    // re-render ellipses after overlap colors change
+    void updateEllipseGraphics();
+    // move graphics to model versions changed since last sync
+    void syncGraphicsItems();
 
  private:
     void setBackgroundImage(QString filename);
-    QImage background_image_;
+    // stream background from tiled basemap file
+    void setBasemap(QString filename);
+    // scene rect covered by background
+    QRectF getBackgroundRect();
+    BackgroundTiles background_tiles_;
 
     // member variables for graphical style
     QPen background_pen_;
@@ -65,10 +95,25 @@ class Canvas : public QGraphicsScene {
     // max render level, used for move selected to front
     qreal front_depth_;
 
+    // only repaint dirty regions of indexed items
+    bool partial_updates_;
+
+    // zoom level of view
+    qreal scaling_factor_;
+    // scrubbed traj history age
+    qint32 history_age_;
+
     // helper functions for drawing grid lines
     qint64 roundUpPast(qint64 n, qint64 m);
     qint64 roundDownPast(qint64 n, qint64 m);
 
+    // grid lines around visible area, kept until zoom changes
+    // grid spacing or exposed area leaves covered bounds
+    void updateGridLines(QRectF const &rect, qint64 segment_size);
+    QVector<QLineF> grid_lines_;
+    QRectF grid_bounds_;
+    qint64 grid_segment_size_;
+
     // size of backgorund image
     qreal background_bottomleft_x_ = 0;
     qreal background_bottomleft_y_ = 0;
@@ -38,6 +38,13 @@ class DroneGraphicsItem : public QGraphicsItem {
     void setIsFeasible(bool feasible);
     bool getIsFeasible();
 
+    // zoom level of view, drone kept same size on screen
+    void setScalingFactor(qreal scaling_factor);
+
+    // move graphic to model pos if model changed since last sync,
+    // called once per frame before painting so paint only reads
+    void syncFromModel();
+
  protected:
     // shape to paint
     QPainterPath shape() const override;
@@ -48,16 +55,26 @@ class DroneGraphicsItem : public QGraphicsItem {
 
  private:
     QPen pen_;
+    QPen selected_pen_;
     QBrush brush_;
+    QFont font_;
 
     // size of drone
     qreal size_;
 
+    // zoom level pens, font and shape are scaled to
+    qreal scaling_factor_;
+    QPainterPath shape_;
+    void updateZoomStyle();
+
+    // model generation graphic was last moved to
+    quint64 synced_generation_;
+    // skip writing model back while moving graphic to model pos
+    bool syncing_;
+
     // for compute thread setting infeasible
     QMutex mutex_;
     bool is_feasible_;
-
-    qreal getScalingFactor() const;
 };
 
 }  // namespace optgui
@@ -43,6 +43,13 @@ class EllipseGraphicsItem : public QGraphicsItem {
     // change color to red for displaying errors
     void setRed(bool isOverlap);
 
+    // zoom level of view, pens and border scaled to it
+    void setScalingFactor(qreal scaling_factor);
+
+    // move graphic, handles and color to model if model changed
+    // since last sync, called once per frame before painting
+    void syncFromModel();
+
  protected:
     // shape to paint
     QPainterPath shape() const override;
@@ -53,16 +60,26 @@ class EllipseGraphicsItem : public QGraphicsItem {
 
  private:
     QPen pen_;
+    QPen selected_pen_;
     QPen clearance_pen_;
     QBrush brush_;
+    QFont font_;
 
     // handles for resizing
     EllipseResizeHandle *width_handle_;
     EllipseResizeHandle *height_handle_;
     EllipseResizeHandle *radius_handle_;
 
-    // scale zoom level
-    qreal getScalingFactor() const;
+    // zoom level pens and fonts are scaled to
+    qreal scaling_factor_;
+    void updateZoomStyle();
+
+    // model generation graphic was last synced to
+    quint64 synced_generation_;
+    // skip writing model back while moving graphic to model pos
+    bool syncing_;
+    // place handles on edges of ellipse
+    void updateHandles();
 };
 
 }  // namespace optgui
@@ -23,9 +23,8 @@ class EllipseResizeHandle : public QGraphicsEllipseItem {
                                  qreal size = 14);
     // unique type for graphic
     int type() const override;
-    // draw graphic
-    void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
-               QWidget *widget = nullptr) override;
+    // zoom level of view, handle kept same size on screen
+    void setScalingFactor(qreal scaling_factor);
 
  protected:
     // respond to mouse input
@@ -45,9 +44,6 @@ class EllipseResizeHandle : public QGraphicsEllipseItem {
 
     // handle manipulates: width == 0, height == 1, both >= 2
     quint8 type_;
-
-    // scale zoom level
-    qreal getScalingFactor() const;
 };
 
 }  // namespace optgui
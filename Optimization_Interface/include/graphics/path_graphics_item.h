@@ -28,6 +28,11 @@ class PathGraphicsItem : public QGraphicsItem {
                QWidget *widget = nullptr) override;
     // set color of traj
     void setColor(QColor);
+    // zoom level of view, line kept same width on screen
+    void setScalingFactor(qreal scaling_factor);
+    // copy points if model changed since last sync,
+    // call from gui thread before scheduling redraw
+    void syncFromModel();
 
     PathModelItem *model_;
 
@@ -42,7 +47,19 @@ class PathGraphicsItem : public QGraphicsItem {
     QPen pen_;
     quint32 width_;
     QMutex mutex_;  // mutex lock for compute thread setting color
-    qreal getScalingFactor() const;
+    qreal scaling_factor_;
+
+    // geometry cached from model, only accessed by gui thread
+    quint64 generation_;
+    QPolygonF polygon_;
+    QPainterPath path_;
+    QRectF bounding_rect_;
+    // points of polygon at least a view pixel apart, drawn instead
+    // of every point so long trajs cost the same when zoomed out
+    QPolygonF decimated_;
+
+    void loadPoints();
+    void decimatePoints();
 };
 
 }  // namespace optgui
@@ -0,0 +1,64 @@
+// TITLE:   Optimization_Interface/include/graphics/path_history_graphics_item.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Graphical overlay of past vehicle trajectories
+
+#ifndef PATH_HISTORY_GRAPHICS_ITEM_H_
+#define PATH_HISTORY_GRAPHICS_ITEM_H_
+
+#include <QGraphicsItem>
+#include <QPainter>
+
+#include "include/globals.h"
+#include "include/models/path_history_model_item.h"
+
+namespace optgui {
+
+class PathHistoryGraphicsItem : public QGraphicsItem {
+ public:
+    explicit PathHistoryGraphicsItem(PathHistoryModelItem *model,
+                                     QGraphicsItem *parent = nullptr,
+                                     quint32 size = 4);
+    // rough area of graphic
+    QRectF boundingRect() const override;
+    // draw graphic
+    void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
+               QWidget *widget = nullptr) override;
+    // zoom level of view, lines kept same width on screen
+    void setScalingFactor(qreal scaling_factor);
+    // highlight traj recorded age replans ago, older trajs faded,
+    // 0 hides overlay
+    void setAge(qint32 age);
+    // copy trajs if model changed since last sync,
+    // called once per frame before painting
+    void syncFromModel();
+
+    PathHistoryModelItem *model_;
+
+ protected:
+    // match zoom and age of canvas when added
+    QVariant itemChange(GraphicsItemChange change,
+                        const QVariant &value) override;
+
+ private:
+    QPen pen_;
+    QFont font_;
+    quint32 width_;
+    qreal scaling_factor_;
+    qint32 age_;
+
+    // copies of recorded trajs, newest first, only accessed by
+    // gui thread. buffers sized to model capacity and reused
+    quint64 generation_;
+    qint32 size_;
+    QVector<QPolygonF> polygons_;
+    QVector<qint64> timestamps_;
+    QVector<bool> feasible_;
+    QRectF bounding_rect_;
+};
+
+}  // namespace optgui
+
+#endif  // PATH_HISTORY_GRAPHICS_ITEM_H_
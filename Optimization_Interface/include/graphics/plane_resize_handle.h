@@ -31,10 +31,8 @@ class PlaneResizeHandle : public QGraphicsEllipseItem {
 
     // get pos of handle
     QPointF getPoint();
-
-    // draw graphic
-    void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
-               QWidget *widget = nullptr) override;
+    // zoom level of view, handle kept same size on screen
+    void setScalingFactor(qreal scaling_factor);
 
  protected:
     // detect mouse input
@@ -54,9 +52,6 @@ class PlaneResizeHandle : public QGraphicsEllipseItem {
 
     // size of handle
     qreal size_;
-
-    // scale zoom level
-    qreal getScalingFactor() const;
 };
 
 }  // namespace optgui
@@ -29,6 +29,12 @@ class PointGraphicsItem : public QGraphicsItem {
                QWidget *widget = nullptr) override;
     // unique type of graphic class
     int type() const override;
+    // zoom level of view, point kept same size on screen
+    void setScalingFactor(qreal scaling_factor);
+
+    // move graphic to model pos if model changed since last sync,
+    // called once per frame before painting so paint only reads
+    void syncFromModel();
 
  protected:
     // shape to draw
@@ -43,10 +49,20 @@ class PointGraphicsItem : public QGraphicsItem {
 
     // graphical info
     QPen pen_;
+    QPen selected_pen_;
     QBrush brush_;
+    QFont font_;
+
+    // zoom level pens, font and shape are scaled to
+    qreal scaling_factor_;
+    QRectF bounding_rect_;
+    QPainterPath shape_;
+    void updateZoomStyle();
 
-    // scale zoom level
-    qreal getScalingFactor() const;
+    // model generation graphic was last moved to
+    quint64 synced_generation_;
+    // skip writing model back while moving graphic to model pos
+    bool syncing_;
 };
 
 }  // namespace optgui
@@ -38,6 +38,13 @@ class PolygonGraphicsItem : public QGraphicsItem {
     // flip direction of constraint
     void flipDirection();
 
+    // zoom level of view, border kept same size on screen
+    void setScalingFactor(qreal scaling_factor);
+
+    // move handles and announce new bounds if model changed since
+    // last sync, called once per frame before painting
+    void syncFromModel();
+
  protected:
     // shape to draw
     QPainterPath shape() const override;
@@ -47,13 +54,26 @@ class PolygonGraphicsItem : public QGraphicsItem {
 
  private:
     QPen pen_;
+    QPen selected_pen_;
     QBrush brush_;
+    QFont font_;
 
     // resize handles
     QVector<PolygonResizeHandle *> resize_handles_;
 
-    // scale zoom level
-    qreal getScalingFactor() const;
+    // zoom level pens, font and border are scaled to
+    qreal scaling_factor_;
+    void updateZoomStyle();
+
+    // border shading cached for model generation, pos and zoom
+    mutable QPainterPath shape_;
+    mutable quint64 shape_generation_;
+    mutable QPointF shape_pos_;
+    mutable bool shape_stale_;
+    QPainterPath buildShape() const;
+
+    // model generation handles were last moved to
+    quint64 synced_generation_;
 };
 
 }  // namespace optgui
@@ -29,9 +29,8 @@ class PolygonResizeHandle : public QGraphicsEllipseItem {
     int type() const override;
     // get model point
     QPointF getPoint();
-    // draw graphic
-    void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
-               QWidget *widget = nullptr) override;
+    // zoom level of view, handle kept same size on screen
+    void setScalingFactor(qreal scaling_factor);
 
  protected:
     // detect mouse input
@@ -50,9 +49,6 @@ class PolygonResizeHandle : public QGraphicsEllipseItem {
 
     // graphic size
     qreal size_;
-
-    // scale zoom level
-    qreal getScalingFactor() const;
 };
 
 }  // namespace optgui
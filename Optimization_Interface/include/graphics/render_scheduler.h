@@ -0,0 +1,100 @@
+// TITLE:   Optimization_Interface/include/graphics/render_scheduler.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Coalesces graphics updates into at most one flush per display frame
+
+#ifndef RENDER_SCHEDULER_H_
+#define RENDER_SCHEDULER_H_
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QGraphicsItem>
+#include <QSet>
+#include <QQueue>
+
+#include "include/graphics/path_graphics_item.h"
+#include "include/controls/planner_stats.h"
+
+namespace optgui {
+
+// Updates from sockets and planner signals are collected here and
+// applied to graphics items together, so items are only moved and
+// re-rendered once per frame no matter how many packets arrive.
+// Each flush first syncs graphics to model generations, so painting
+// never writes to models.
+// Lives in gui thread, other threads reach it through queued signals
+class RenderScheduler : public QObject {
+    Q_OBJECT
+
+ public:
+    explicit RenderScheduler(QObject *parent = nullptr);
+    ~RenderScheduler();
+
+    // max flushes per second, 0 to flush on next event loop
+    void setMaxFrameRate(qreal rate);
+    qreal getMaxFrameRate();
+
+    // drop pending updates for item about to be deleted
+    void removeItem(QGraphicsItem *item);
+
+    // record time to paint one frame of view
+    void recordPaint(qint64 nsecs);
+    // time between painted frames
+    LatencyHistogram const &getFrameTimes() const;
+    // time to paint one frame
+    LatencyHistogram const &getPaintTimes() const;
+    // frames painted in last second
+    qreal getFrameRate() const;
+    // updates requested and flushes run
+    quint64 getRequests() const;
+    quint64 getFlushes() const;
+
+ public slots:
+    // re-render item on next flush, after graphics are synced
+    // to their models
+    void updateItem(QGraphicsItem *item);
+    // load new path points and re-render on next flush
+    void syncPath(PathGraphicsItem *path);
+    // flush so graphics are synced to changed models, for
+    // models written by other threads
+    void requestSync();
+
+ signals:
+    // move graphics to their model pos at start of flush,
+    // connected directly so it runs before items are re-rendered
+    void syncGraphics();
+
+ private slots:
+    // apply pending moves and updates
+    void flush();
+
+ private:
+    // start timer for next frame if not already waiting
+    void scheduleFlush();
+
+    QTimer *timer_;
+    qreal max_frame_rate_;
+
+    // pending updates
+    QSet<QGraphicsItem *> updates_;
+    QSet<PathGraphicsItem *> paths_;
+
+    // time of last flush for limiting frame rate
+    QElapsedTimer clock_;
+    qint64 last_flush_msecs_;
+
+    // frame counters
+    quint64 requests_;
+    quint64 flushes_;
+    LatencyHistogram frame_times_;
+    LatencyHistogram paint_times_;
+    qint64 last_paint_nsecs_;
+    QQueue<qint64> recent_msecs_;
+};
+
+}  // namespace optgui
+
+#endif  // RENDER_SCHEDULER_H_
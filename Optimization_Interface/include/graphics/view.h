@@ -17,8 +17,6 @@
 #include <QGestureEvent>
 #include <QDoubleSpinBox>
 
-#include "algorithm.h"
-
 #include "include/graphics/canvas.h"
 #include "include/window/menu_panel.h"
 #include "include/globals.h"
@@ -40,6 +38,10 @@ class View : public QGraphicsView {
     bool viewportEvent(QEvent *event) override;
     // expand canvas when view expands
     void resizeEvent(QResizeEvent *event) override;
+    // redraw meter scale moved by scrolling
+    void scrollContentsBy(int dx, int dy) override;
+    // time painted frames
+    void paintEvent(QPaintEvent *event) override;
     // handle mouse input for toggle mode
     void mousePressEvent(QMouseEvent *event) override;
 
@@ -80,6 +82,10 @@ class View : public QGraphicsView {
     // set clearance around ellipses (in meters)
     void setClearance(qreal clearance);
 
+    // set max replans per second for compute threads
+    void setMaxReplanRate(qreal rate);
+    void setMaxFrameRate(qreal rate);
+
     // set upper/lower bounds on waypoint index
     // when K is changed
     void constrainWpIdx(int value);
@@ -90,11 +96,21 @@ class View : public QGraphicsView {
 
     // update user feedback box message
     void updateFeedbackMessage();
+    // update expert panel planner stats for current drone
+    void updateStatsTable();
     void setCurrEndpoints();
     void toggleSim(int);
     void toggleTrajLock(int);
     void toggleFreeFinalTime(int);
     void toggleDataCapture(int);
+    void toggleWarmStart(int);
+    void toggleReferenceSolver(int);
+    void togglePartialUpdates(int);
+    void toggleOpenGLViewport(int);
+    // step back through traj history, 0 for live traj only
+    void setHistoryAge(int age);
+    // write stage latencies for all drones to file
+    void dumpPlannerStats();
 
   private:
     void initializeMenuPanel();
@@ -140,6 +156,11 @@ class View : public QGraphicsView {
     quint32 a_max_row;
     quint32 wp_idx_row;
     QTableWidget *model_params_table_;
+    // stage latencies and solver counters for current drone
+    QTableWidget *stats_table_;
+    QLabel *stats_label_;
+    // traj history scrubber
+    QLabel *history_label_;
 
     // keep track of all widgets to delete them
     QVector<QWidget *> panel_widgets_;
@@ -169,6 +190,16 @@ class View : public QGraphicsView {
     // expert panel skyefly params
     void initializeSkyeFlyParamsTable(MenuPanel *panel);
     void initializeDataCaptureToggle(MenuPanel *panel);
+    void initializeWarmStartToggle(MenuPanel *panel);
+    void initializeReferenceSolverToggle(MenuPanel *panel);
+    void initializePartialUpdatesToggle(MenuPanel *panel);
+    void initializeOpenGLViewportToggle(MenuPanel *panel);
+    void initializeHistoryScrubber(MenuPanel *panel);
+    // render through opengl viewport or raster widget,
+    // false if no opengl context could be created
+    bool setOpenGLViewport(bool enabled);
+    // expert panel planner stats
+    void initializeStatsTable(MenuPanel *panel);
     // expert panel constraint_model params not in skyefly
     void initializeModelParamsTable(MenuPanel *panel);
 };
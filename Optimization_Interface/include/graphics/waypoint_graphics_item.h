@@ -33,6 +33,12 @@ class WaypointGraphicsItem : public QGraphicsItem {
     int type() const override;
     // set ordering of waypoint
     void setIndex(quint32 index);
+    // zoom level of view, waypoint kept same size on screen
+    void setScalingFactor(qreal scaling_factor);
+
+    // move graphic to model pos if model changed since last sync,
+    // called once per frame before painting so paint only reads
+    void syncFromModel();
 
  protected:
     // shape to draw
@@ -44,13 +50,24 @@ class WaypointGraphicsItem : public QGraphicsItem {
  private:
     // graphical info
     QPen pen_;
+    QPen selected_pen_;
     QBrush brush_;
+    QFont index_font_;
+    QFont port_font_;
 
     // size of graphic
     qreal radius_;
 
-    // scale zoom level
-    qreal getScalingFactor() const;
+    // zoom level pens, fonts and shape are scaled to
+    qreal scaling_factor_;
+    QRectF bounding_rect_;
+    QPainterPath shape_;
+    void updateZoomStyle();
+
+    // model generation graphic was last moved to
+    quint64 synced_generation_;
+    // skip writing model back while moving graphic to model pos
+    bool syncing_;
 
     // ordering of waypoint
     quint32 index_;
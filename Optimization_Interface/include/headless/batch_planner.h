@@ -0,0 +1,53 @@
+// TITLE:   Optimization_Interface/include/headless/batch_planner.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Plans many scene files in parallel on a pool sized to the hardware
+
+#ifndef BATCH_PLANNER_H_
+#define BATCH_PLANNER_H_
+
+#include <QThreadPool>
+#include <QMutex>
+#include <QStringList>
+#include <QDir>
+
+#include "include/globals.h"
+
+namespace optgui {
+
+class BatchJob;
+
+class BatchPlanner {
+ public:
+    // plan with given number of threads, 0 for one per core
+    BatchPlanner(QString const &output_dir, SOLVER_BACKEND backend,
+                 int threads = 0);
+    ~BatchPlanner();
+
+    // plan every scene file, blocking until all finish.
+    // return number of scenes that failed to load or write
+    int run(QStringList const &scene_files);
+
+ private:
+    friend class BatchJob;
+
+    QThreadPool pool_;
+    QDir output_dir_;
+    SOLVER_BACKEND backend_;
+
+    // lock for failure count and console output
+    QMutex mutex_;
+    int failures_;
+
+    // load, solve and write traj for one scene, called on pool thread
+    void planScene(QString const &scene_file);
+    // print result line for scene
+    void report(QString const &scene_file, QString const &message,
+                bool failed);
+};
+
+}  // namespace optgui
+
+#endif  // BATCH_PLANNER_H_
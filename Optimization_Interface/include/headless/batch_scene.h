@@ -0,0 +1,61 @@
+// TITLE:   Optimization_Interface/include/headless/batch_scene.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Scene loaded from a json description and planned without a display
+
+#ifndef BATCH_SCENE_H_
+#define BATCH_SCENE_H_
+
+#include <QString>
+#include <QVector>
+#include <QVector3D>
+#include <QJsonObject>
+
+#include <memory>
+
+#include "include/models/constraint_model.h"
+#include "include/solvers/trajectory_solver.h"
+
+namespace optgui {
+
+class BatchScene {
+ public:
+    BatchScene();
+
+    // load scene from json file, return false and set error
+    // message if file cannot be read or is missing fields
+    bool load(QString const &filename, QString *error);
+    // solve for traj with backend, return whether traj is feasible
+    bool plan(SOLVER_BACKEND backend);
+    // write solved traj to csv file in NED,
+    // return false if file cannot be opened
+    bool writeTrajectory(QString const &filename);
+
+    // time of last solve in msecs
+    qint64 getSolveMsecs();
+    // constraint violation of last solved traj
+    double getViolation();
+
+ private:
+    // owns constraint data models added by load
+    ConstraintModel model_;
+
+    // drone state and target in gui coords
+    QVector3D initial_pos_;
+    QVector3D initial_vel_;
+    QVector3D initial_acc_;
+    QVector3D final_pos_;
+
+    std::unique_ptr<TrajectorySolver> solver_;
+    TrajectoryOutputs outputs_;
+    qint64 solve_msecs_;
+
+    // read optional skyefly params over model defaults
+    void loadParams(QJsonObject const &params);
+};
+
+}  // namespace optgui
+
+#endif  // BATCH_SCENE_H_
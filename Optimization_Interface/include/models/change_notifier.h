@@ -0,0 +1,71 @@
+// TITLE:   Optimization_Interface/include/models/change_notifier.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Revision counter that wakes compute threads when model data changes
+
+#ifndef CHANGE_NOTIFIER_H_
+#define CHANGE_NOTIFIER_H_
+
+#include <QMutex>
+#include <QWaitCondition>
+#include <QAtomicInteger>
+
+#include <climits>
+
+namespace optgui {
+
+class ChangeNotifier {
+ public:
+    // changes are also counted by parent notifier if given
+    explicit ChangeNotifier(ChangeNotifier *parent = nullptr) :
+        mutex_(), wait_condition_(), revision_(0), parent_(parent) {}
+
+    ~ChangeNotifier() {
+        // acquire lock to destroy it
+        QMutexLocker locker(&this->mutex_);
+    }
+
+    quint64 getRevision() {
+        // lock free read of current revision
+        return this->revision_.loadAcquire();
+    }
+
+    void notify() {
+        {
+            QMutexLocker locker(&this->mutex_);
+            // bump revision and wake all waiting threads
+            this->revision_.fetchAndAddOrdered(1);
+            this->wait_condition_.wakeAll();
+        }
+        // propagate change to combined revision
+        if (this->parent_) {
+            this->parent_->notify();
+        }
+    }
+
+    quint64 waitForChange(quint64 revision,
+                          unsigned long timeout = ULONG_MAX) {
+        QMutexLocker locker(&this->mutex_);
+        // block until revision moves past given revision or timeout,
+        // return revision seen on wake
+        if (this->revision_.loadAcquire() == revision) {
+            this->wait_condition_.wait(&this->mutex_, timeout);
+        }
+        return this->revision_.loadAcquire();
+    }
+
+ private:
+    // mutex lock for wait condition
+    QMutex mutex_;
+    QWaitCondition wait_condition_;
+    // incremented on every change
+    QAtomicInteger<quint64> revision_;
+    // notifier combining this revision with others
+    ChangeNotifier *parent_;
+};
+
+}  // namespace optgui
+
+#endif  // CHANGE_NOTIFIER_H_
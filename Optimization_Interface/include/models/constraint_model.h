@@ -14,8 +14,8 @@
 #include <QMutex>
 #include <QTableWidget>
 
-#include "cprs.h"
-#include "algorithm.h"
+#include <memory>
+
 #include "autogen/lib.h"
 
 #include "include/globals.h"
@@ -25,6 +25,8 @@
 #include "include/models/plane_model_item.h"
 #include "include/models/path_model_item.h"
 #include "include/models/drone_model_item.h"
+#include "include/models/change_notifier.h"
+#include "include/models/scene_snapshot.h"
 
 namespace optgui {
 
@@ -71,10 +73,12 @@ class ConstraintModel {
     void addDrone(DroneModelItem *drone, PathModelItem *traj);
     void removeDrone(DroneModelItem *item);
 
-    // functions for skyenet params
-    skyenet::params getSkyeFlyParams();
+    // functions for problem params
+    TrajectoryProblem getSkyeFlyParams();
     // copy params from expert panel to model params member
     void setSkyeFlyParams(QTableWidget *params_table);
+    // copy params from outside expert panel, such as scene files
+    void setSkyeFlyParams(TrajectoryProblem const &P);
 
     // functions for final time
     qreal getFinaltime();
@@ -117,6 +121,12 @@ class ConstraintModel {
     bool isLiveReference();
     void setFreeFinalTime(bool free_final_time);
     bool isFreeFinalTime();
+    // functions for seeding solves with the previous traj
+    void setWarmStart(bool warm_start);
+    bool isWarmStart();
+    // functions for choosing trajectory solver backend
+    void setSolverBackend(SOLVER_BACKEND backend);
+    SOLVER_BACKEND getSolverBackend();
 
     // functions for valid input detection
     INPUT_CODE getIsValidInput();
@@ -134,17 +144,40 @@ class ConstraintModel {
     bool isCurrDrone(DroneModelItem *drone);
     DroneModelItem *getCurrDrone();
 
-    // funtions for loading data into a skyenet params
-    void loadWaypointConstraints(skyenet::params *P,
-                                 double wp[skyenet::MAX_WAYPOINTS][3]);
-    void loadEllipseConstraints(skyenet::params *P);
-    void loadPosConstraints(skyenet::params *P);
+    // functions for waking compute threads on model changes.
+    // revision combines all item generations and model changes
+    quint64 getRevision();
+    // revision of constraints, waypoints and params shared by all drones,
+    // excludes drone telemetry and targets
+    quint64 getSceneRevision();
+    // get immutable copy of scene at current scene revision,
+    // lock free unless scene changed since last copy
+    std::shared_ptr<SceneSnapshot const> getSnapshot();
+    // block until model revision differs from given revision or timeout
+    quint64 waitForChange(quint64 revision,
+                          unsigned long timeout = ULONG_MAX);
+    void notifyChange();
+
+    // functions for max replans per second, 0 for unlimited
+    qreal getMaxReplanRate();
+    void setMaxReplanRate(qreal rate);
 
 private:
     QMutex model_lock_;
 
-    // skyenet params
-    skyenet::params P_;
+    // wakes compute threads when constraints or telemetry change
+    ChangeNotifier notifier_;
+    // counts changes to inputs shared by all drones, bumps notifier_
+    ChangeNotifier scene_notifier_;
+    // last published scene copy, swapped atomically
+    std::shared_ptr<SceneSnapshot const> snapshot_;
+
+    // problem params, constraints loaded separately by planners
+    TrajectoryProblem P_;
+    // incremented when params change
+    quint64 params_revision_;
+    // incremented when constraints are added or removed
+    quint64 constraints_revision_;
     autogen::packet::traj3dof drone_staged_traj3dof_data_;
 
     // input and feasibility status
@@ -156,10 +189,15 @@ private:
     // flag for tracking a sent trajectory
     bool is_live_reference_;
     bool is_free_final_time_;
+    bool is_warm_start_;
+    SOLVER_BACKEND solver_backend_;
 
     // Clearance around ellipses in meters
     qreal clearance_;
 
+    // Max replans per second for each compute thread
+    qreal max_replan_rate_;
+
     // Constraints
     QSet<EllipseModelItem *> ellipses_;
     QSet<PolygonModelItem *> polygons_;
@@ -174,11 +212,8 @@ private:
     QSet<PointModelItem *> final_points_;
     DroneModelItem *curr_drone_;
 
-    // Convert constraints to skyefly params
-    void loadPlaneConstraint(skyenet::params *P, quint32 index,
-                                 QVector3D p, QVector3D q);
-    int distributeWpEvenly(skyenet::params *P, int index, int remaining,
-                         int low, int high);
+    // copy scene data for compute threads
+    SceneSnapshot *buildSnapshot();
 };
 
 }  // namespace optgui
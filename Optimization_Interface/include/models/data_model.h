@@ -9,17 +9,47 @@
 #define DATA_MODEL_H_
 
 #include <QtMath>
+#include <QAtomicPointer>
+#include <QAtomicInteger>
+
+#include "include/models/change_notifier.h"
 
 namespace optgui {
 
 class DataModel {
  public:
     // default initialize port to 0
-    DataModel() : port_(0) {}
+    DataModel() : port_(0), generation_(0), notifier_(nullptr) {}
     virtual ~DataModel() {}
 
     // network port
     quint16 port_;
+
+    // generation of item data, incremented on every change.
+    // lock free so readers can skip work for unchanged items
+    quint64 getGeneration() const {
+        return this->generation_.loadAcquire();
+    }
+
+    // set notifier to wake when item data changes,
+    // nullptr to stop notifying
+    void setNotifier(ChangeNotifier *notifier) {
+        this->notifier_.storeRelease(notifier);
+    }
+
+ protected:
+    // bump generation and wake compute threads waiting on item data
+    void notifyChange() {
+        this->generation_.fetchAndAddOrdered(1);
+        ChangeNotifier *notifier = this->notifier_.loadAcquire();
+        if (notifier) {
+            notifier->notify();
+        }
+    }
+
+ private:
+    QAtomicInteger<quint64> generation_;
+    QAtomicPointer<ChangeNotifier> notifier_;
 };
 
 }  // namespace optgui
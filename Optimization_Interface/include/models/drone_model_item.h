@@ -12,6 +12,9 @@
 #include <QVector3D>
 #include <QString>
 #include <QMutex>
+#include <QAtomicInteger>
+
+#include <atomic>
 
 #include "include/models/data_model.h"
 
@@ -19,13 +22,23 @@
 
 namespace optgui {
 
+// drone state from a single telemetry packet
+struct DroneTelemetry {
+    QVector3D pos;
+    QVector3D vel;
+    QVector3D accel;
+    // msecs since epoch when received, 0 if never received
+    qint64 timestamp;
+};
+
 class DroneModelItem : public DataModel {
  public:
-    explicit DroneModelItem(QPointF const &pos) : mutex_() {
-        this->pos_ = QVector3D(pos.x(), pos.y(), 0);
-        this->vel_ = QVector3D(0, 0, 0);
+    explicit DroneModelItem(QPointF const &pos) : mutex_(), sequence_(0) {
+        this->telemetry_.pos = QVector3D(pos.x(), pos.y(), 0);
+        this->telemetry_.vel = QVector3D(0, 0, 0);
         // counteract gravity
-        this->accel_ = QVector3D(0, 0, 9.81 * GRID_SIZE);
+        this->telemetry_.accel = QVector3D(0, 0, 9.81 * GRID_SIZE);
+        this->telemetry_.timestamp = 0;
         port_ = 0;
         destination_port_ = 6000;
         ip_addr_ = "0.0.0.0";
@@ -36,37 +49,80 @@ class DroneModelItem : public DataModel {
         QMutexLocker locker(&this->mutex_);
     }
 
-    QVector3D getPos() {
+    DroneTelemetry getTelemetry() {
+        // lock free seqlock read, retry if a write overlapped the copy
+        // so pos, vel and accel always come from the same packet
+        forever {
+            quint32 sequence = this->sequence_.loadAcquire();
+            if (sequence & 1) {
+                continue;
+            }
+            DroneTelemetry telemetry = this->telemetry_;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (this->sequence_.load() == sequence) {
+                return telemetry;
+            }
+        }
+    }
+
+    // set whole telemetry state at once,
+    // return whether pos, vel or accel changed
+    bool setTelemetry(DroneTelemetry const &telemetry) {
         QMutexLocker locker(&this->mutex_);
+        // only bump generation on new telemetry
+        bool changed = this->telemetry_.pos != telemetry.pos ||
+                this->telemetry_.vel != telemetry.vel ||
+                this->telemetry_.accel != telemetry.accel;
+        this->writeTelemetry(telemetry);
+        if (changed) {
+            this->notifyChange();
+        }
+        return changed;
+    }
+
+    QVector3D getPos() {
         // get copy of pos
-        return this->pos_;
+        return this->getTelemetry().pos;
     }
 
     void setPos(QVector3D pos) {
         QMutexLocker locker(&this->mutex_);
-        this->pos_ = pos;
+        if (this->telemetry_.pos != pos) {
+            DroneTelemetry telemetry = this->telemetry_;
+            telemetry.pos = pos;
+            this->writeTelemetry(telemetry);
+            this->notifyChange();
+        }
     }
 
     QVector3D getVel() {
-        QMutexLocker locker(&this->mutex_);
         // get copy of velocity
-        return this->vel_;
+        return this->getTelemetry().vel;
     }
 
     void setVel(QVector3D vel) {
         QMutexLocker locker(&this->mutex_);
-        this->vel_ = vel;
+        if (this->telemetry_.vel != vel) {
+            DroneTelemetry telemetry = this->telemetry_;
+            telemetry.vel = vel;
+            this->writeTelemetry(telemetry);
+            this->notifyChange();
+        }
     }
 
     QVector3D getAccel() {
-        QMutexLocker locker(&this->mutex_);
         // get copy of acceleration
-        return this->accel_;
+        return this->getTelemetry().accel;
     }
 
     void setAccel(QVector3D accel) {
         QMutexLocker locker(&this->mutex_);
-        this->accel_ = accel;
+        if (this->telemetry_.accel != accel) {
+            DroneTelemetry telemetry = this->telemetry_;
+            telemetry.accel = accel;
+            this->writeTelemetry(telemetry);
+            this->notifyChange();
+        }
     }
 
     // IP addr of drone
@@ -75,11 +131,20 @@ class DroneModelItem : public DataModel {
     quint16 destination_port_;
 
  private:
-    // mutex lock for getters/setters
+    // mutex lock serializing writers, readers do not lock
     QMutex mutex_;
-    QVector3D pos_;
-    QVector3D vel_;
-    QVector3D accel_;
+    // seqlock sequence, odd while a write is in progress
+    QAtomicInteger<quint32> sequence_;
+    DroneTelemetry telemetry_;
+
+    void writeTelemetry(DroneTelemetry const &telemetry) {
+        // caller must hold mutex
+        quint32 sequence = this->sequence_.load();
+        this->sequence_.store(sequence + 1);
+        std::atomic_thread_fence(std::memory_order_release);
+        this->telemetry_ = telemetry;
+        this->sequence_.storeRelease(sequence + 2);
+    }
 };
 
 }  // namespace optgui
@@ -47,9 +47,14 @@ class EllipseModelItem : public DataModel {
 
     void setWidth(qreal width) {
         QMutexLocker locker(&this->mutex_);
+        // skip regenerating region if unchanged
+        if (this->width_ == width) {
+            return;
+        }
         this->width_ = width;
         // update region
         this->region_ = this->generateRegion();
+        this->notifyChange();
     }
 
     qreal getHeight() {
@@ -60,9 +65,14 @@ class EllipseModelItem : public DataModel {
 
     void setHeight(qreal height) {
         QMutexLocker locker(&this->mutex_);
+        // skip regenerating region if unchanged
+        if (this->height_ == height) {
+            return;
+        }
         this->height_ = height;
         // update region
         this->region_ = this->generateRegion();
+        this->notifyChange();
     }
 
     qreal getRot() {
@@ -73,9 +83,14 @@ class EllipseModelItem : public DataModel {
 
     void setRot(qreal rot) {
         QMutexLocker locker(&this->mutex_);
+        // skip regenerating region if unchanged
+        if (this->rot_ == rot) {
+            return;
+        }
         this->rot_ = rot;
         // update region
         this->region_ = this->generateRegion();
+        this->notifyChange();
     }
 
     QPointF getPos() {
@@ -86,10 +101,15 @@ class EllipseModelItem : public DataModel {
 
     void setPos(QPointF pos) {
         QMutexLocker locker(&this->mutex_);
+        // skip regenerating region if not moved
+        if (this->pos_ == pos) {
+            return;
+        }
         this->pos_.setX(pos.x());
         this->pos_.setY(pos.y());
         // update region
         this->region_ = this->generateRegion();
+        this->notifyChange();
     }
 
     bool getDirection() {
@@ -103,6 +123,7 @@ class EllipseModelItem : public DataModel {
         QMutexLocker locker(&this->mutex_);
         // flip direction of constraint inequality
         this->direction_ = !this->direction_;
+        this->notifyChange();
     }
 
     qreal getClearance() {
@@ -113,9 +134,14 @@ class EllipseModelItem : public DataModel {
 
     void setClearance(qreal clearance) {
         QMutexLocker locker(&this->mutex_);
+        // skip regenerating region if unchanged
+        if (this->clearance_ == clearance) {
+            return;
+        }
         this->clearance_ = clearance;
         // update region
         this->region_ = this->generateRegion();
+        this->notifyChange();
     }
 
     bool getIsOverlap() {
@@ -0,0 +1,40 @@
+// TITLE:   Optimization_Interface/include/models/params_cache.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Record of model data loaded into a persistent trajectory problem,
+// used to only rebuild constraint slots whose items changed
+
+#ifndef PARAMS_CACHE_H_
+#define PARAMS_CACHE_H_
+
+#include <QVector>
+#include <QPair>
+
+#include "include/models/data_model.h"
+
+namespace optgui {
+
+struct ParamsCache {
+    ParamsCache() : params_revision(0), obs_revision(0),
+        cpos_revision(0), clearance(-1) {}
+
+    // model params revision copied into params
+    quint64 params_revision;
+    // model constraint set revision slots were loaded from
+    quint64 obs_revision;
+    quint64 cpos_revision;
+    // clearance used for ellipse slots
+    qreal clearance;
+
+    // item and generation loaded into each obs slot
+    QVector<QPair<DataModel *, quint64>> obs;
+    // item and generation loaded into each polygon or plane block
+    // of cpos slots
+    QVector<QPair<DataModel *, quint64>> cpos;
+};
+
+}  // namespace optgui
+
+#endif  // PARAMS_CACHE_H_
@@ -0,0 +1,150 @@
+// TITLE:   Optimization_Interface/include/models/path_history_model_item.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Fixed size ring buffer of past trajectories for one vehicle
+
+#ifndef PATH_HISTORY_MODEL_ITEM_H_
+#define PATH_HISTORY_MODEL_ITEM_H_
+
+#include <QPointF>
+#include <QVector>
+#include <QMutex>
+#include <QDateTime>
+
+#include <algorithm>
+
+#include "include/models/data_model.h"
+
+namespace optgui {
+
+// one recorded trajectory
+struct PathHistoryEntry {
+    PathHistoryEntry() : points(), timestamp(0), is_feasible(true) {}
+
+    QVector<QPointF> points;
+    qint64 timestamp;  // msecs since epoch
+    bool is_feasible;
+};
+
+class PathHistoryModelItem : public DataModel {
+ public:
+    // all slots allocated up front, slot points keep their capacity
+    // so recording stops allocating once every slot has held a traj
+    // as long as any before it
+    explicit PathHistoryModelItem(qint32 capacity) :
+        DataModel(), mutex_(), pending_mutex_(),
+        entries_(qMax(capacity, 1)), pending_(), has_pending_(false),
+        head_(0), size_(0) {
+    }
+
+    ~PathHistoryModelItem() {
+        // acquire locks to destroy them
+        QMutexLocker locker(&this->mutex_);
+        QMutexLocker pending_locker(&this->pending_mutex_);
+    }
+
+    qint32 getCapacity() {
+        QMutexLocker locker(&this->mutex_);
+        return this->entries_.size();
+    }
+
+    qint32 getSize() {
+        QMutexLocker locker(&this->mutex_);
+        this->commitPending();
+        // number of recorded trajs, up to capacity
+        return this->size_;
+    }
+
+    // called from compute thread, never waits on readers copying
+    // out of the ring. traj is staged in pending slot and moved into
+    // the ring now if ring is free, else by the next reader
+    void record(QVector<QPointF> const &points, bool is_feasible) {
+        {
+            QMutexLocker pending_locker(&this->pending_mutex_);
+            // overwrites a pending traj no reader picked up yet,
+            // copy points instead of sharing them so pending
+            // buffer is reused by later records
+            copyPoints(points, &this->pending_.points);
+            this->pending_.timestamp = QDateTime::currentMSecsSinceEpoch();
+            this->pending_.is_feasible = is_feasible;
+            this->has_pending_ = true;
+        }
+        if (this->mutex_.tryLock()) {
+            this->commitPending();
+            this->mutex_.unlock();
+        }
+        this->notifyChange();
+    }
+
+    // copy traj recorded age records ago into given buffers,
+    // 0 is most recent, false if fewer trajs recorded
+    bool getEntry(qint32 age, QVector<QPointF> *points,
+                  qint64 *timestamp, bool *is_feasible) {
+        QMutexLocker locker(&this->mutex_);
+        this->commitPending();
+        if (age < 0 || age >= this->size_) {
+            return false;
+        }
+        qint32 capacity = this->entries_.size();
+        PathHistoryEntry const &entry =
+                this->entries_.at((this->head_ - 1 - age + capacity) %
+                                  capacity);
+        copyPoints(entry.points, points);
+        *timestamp = entry.timestamp;
+        *is_feasible = entry.is_feasible;
+        return true;
+    }
+
+    void clear() {
+        QMutexLocker locker(&this->mutex_);
+        QMutexLocker pending_locker(&this->pending_mutex_);
+        // keep slot buffers for reuse
+        this->has_pending_ = false;
+        this->head_ = 0;
+        this->size_ = 0;
+        this->notifyChange();
+    }
+
+ private:
+    // mutex lock for ring, held by readers while copying
+    QMutex mutex_;
+    // mutex lock for pending slot, only held for one traj copy
+    // by writer or one slot swap by ring owner
+    QMutex pending_mutex_;
+    // ring of recorded trajs
+    QVector<PathHistoryEntry> entries_;
+    // last recorded traj not yet moved into ring
+    PathHistoryEntry pending_;
+    bool has_pending_;
+    // slot written by next record
+    qint32 head_;
+    qint32 size_;
+
+    // move pending traj into oldest slot, caller must hold mutex.
+    // swaps buffers so the oldest slot buffer becomes pending buffer
+    void commitPending() {
+        QMutexLocker pending_locker(&this->pending_mutex_);
+        if (!this->has_pending_) {
+            return;
+        }
+        std::swap(this->entries_[this->head_], this->pending_);
+        this->has_pending_ = false;
+
+        this->head_ = (this->head_ + 1) % this->entries_.size();
+        this->size_ = qMin(this->size_ + 1, this->entries_.size());
+    }
+
+    static void copyPoints(QVector<QPointF> const &src,
+                           QVector<QPointF> *dst) {
+        // resize keeps capacity when shrinking,
+        // only allocates if dst never held this many points
+        dst->resize(src.size());
+        std::copy(src.constBegin(), src.constEnd(), dst->begin());
+    }
+};
+
+}  // namespace optgui
+
+#endif  // PATH_HISTORY_MODEL_ITEM_H_
@@ -12,6 +12,8 @@
 #include <QVector>
 #include <QMutex>
 
+#include <algorithm>
+
 #include "include/models/data_model.h"
 
 namespace optgui {
@@ -39,6 +41,7 @@ class PathModelItem : public DataModel {
             QPointF &temp = this->points_[index];
             temp.setX(point.x());
             temp.setY(point.y());
+            this->notifyChange();
         }
     }
 
@@ -57,12 +60,26 @@ class PathModelItem : public DataModel {
         QMutexLocker locker(&this->mutex_);
         // copy over points
         this->points_ = points;
+        this->notifyChange();
+    }
+
+    // copy points into traj buffer instead of sharing caller buffer,
+    // so caller can refill its buffer without detaching it
+    void copyPoints(QVector<QPointF> const &points) {
+        QMutexLocker locker(&this->mutex_);
+        // only allocates if buffer is shared with a getPoints copy
+        // or never held this many points
+        this->points_.resize(points.size());
+        std::copy(points.constBegin(), points.constEnd(),
+                  this->points_.begin());
+        this->notifyChange();
     }
 
     void addPoint(QPointF point) {
         QMutexLocker locker(&this->mutex_);
         // append point to traj
         this->points_.append(point);
+        this->notifyChange();
     }
 
     void removePointAt(int index) {
@@ -70,12 +87,14 @@ class PathModelItem : public DataModel {
         // remove point from traj if within bounds
         if (index < this->points_.size()) {
             this->points_.removeAt(index);
+            this->notifyChange();
         }
     }
 
     void clearPoints() {
         QMutexLocker locker(&this->mutex_);
         this->points_.clear();
+        this->notifyChange();
     }
 
     QVector<QPointF> getPoints() {
@@ -38,8 +38,11 @@ class PlaneModelItem : public DataModel {
     void setP1(QPointF pos) {
         QMutexLocker locker(&this->mutex_);
         // set first point in xyz pixels
-        this->p1_.setX(pos.x());
-        this->p1_.setY(pos.y());
+        if (this->p1_ != pos) {
+            this->p1_.setX(pos.x());
+            this->p1_.setY(pos.y());
+            this->notifyChange();
+        }
     }
 
     QPointF getP2() {
@@ -50,9 +53,12 @@ class PlaneModelItem : public DataModel {
 
     void setP2(QPointF pos) {
         QMutexLocker locker(&this->mutex_);
-        // get copy of second point in xyz pixels
-        this->p2_.setX(pos.x());
-        this->p2_.setY(pos.y());
+        // set second point in xyz pixels
+        if (this->p2_ != pos) {
+            this->p2_.setX(pos.x());
+            this->p2_.setY(pos.y());
+            this->notifyChange();
+        }
     }
 
     bool getDirection() {
@@ -65,6 +71,7 @@ class PlaneModelItem : public DataModel {
         QMutexLocker locker(&this->mutex_);
         // flip direction of constraint
         this->direction_ = !this->direction_;
+        this->notifyChange();
     }
 
  private:
@@ -35,8 +35,12 @@ class PointModelItem : public DataModel {
 
     void setPos(QPointF pos) {
         QMutexLocker locker(&this->mutex_);
-        this->pos_.setX(pos.x());
-        this->pos_.setY(pos.y());
+        // only bump generation if moved
+        if (this->pos_ != pos) {
+            this->pos_.setX(pos.x());
+            this->pos_.setY(pos.y());
+            this->notifyChange();
+        }
     }
 
  private:
@@ -39,8 +39,11 @@ class PolygonModelItem : public DataModel {
         QMutexLocker locker(&this->mutex_);
         // set point of vertex without bounds checking
         QPointF &temp = this->points_[index];
-        temp.setX(point.x());
-        temp.setY(point.y());
+        if (temp != point) {
+            temp.setX(point.x());
+            temp.setY(point.y());
+            this->notifyChange();
+        }
     }
 
     QPointF getPointAt(quint32 index) {
@@ -49,6 +52,12 @@ class PolygonModelItem : public DataModel {
         return this->points_.value(index);
     }
 
+    QVector<QPointF> getPoints() {
+        QMutexLocker locker(&this->mutex_);
+        // get copy of all verticies in xyz pixels
+        return this->points_;
+    }
+
     bool getDirection() {
         QMutexLocker locker(&this->mutex_);
         // get direction of constraint inequality
@@ -59,6 +68,7 @@ class PolygonModelItem : public DataModel {
         QMutexLocker locker(&this->mutex_);
         // flip direction of constraint inequality
         this->direction_ = !this->direction_;
+        this->notifyChange();
     }
 
     bool isConvex() {
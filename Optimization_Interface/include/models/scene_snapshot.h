@@ -0,0 +1,109 @@
+// TITLE:   Optimization_Interface/include/models/scene_snapshot.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Immutable copy of constraints, waypoints and params shared by
+// all compute threads, read without locking the constraint model
+
+#ifndef SCENE_SNAPSHOT_H_
+#define SCENE_SNAPSHOT_H_
+
+#include <QVector>
+#include <QPointF>
+#include <QRegion>
+#include <QVector3D>
+
+#include "include/globals.h"
+#include "include/models/data_model.h"
+#include "include/models/params_cache.h"
+#include "include/solvers/trajectory_problem.h"
+
+namespace optgui {
+
+// copy of ellipse obstacle data
+struct EllipseData {
+    // identifies item in params cache, never dereferenced
+    DataModel *item;
+    quint64 generation;
+    QPointF pos;
+    qreal width;
+    qreal height;
+    qreal rot;
+};
+
+// copy of polygon constraint data
+struct PolygonData {
+    // identifies item in params cache, never dereferenced
+    DataModel *item;
+    quint64 generation;
+    QVector<QPointF> points;
+    bool direction;
+};
+
+// copy of plane constraint data
+struct PlaneData {
+    // identifies item in params cache, never dereferenced
+    DataModel *item;
+    quint64 generation;
+    QPointF p1;
+    QPointF p2;
+    bool direction;
+};
+
+class SceneSnapshot {
+ public:
+    SceneSnapshot();
+
+    // scene revision of constraint model when copied
+    quint64 revision_;
+    // model revisions for params cache
+    quint64 params_revision_;
+    quint64 constraints_revision_;
+
+    // problem params without constraints loaded
+    TrajectoryProblem P_;
+    // clearance around ellipses in meters
+    qreal clearance_;
+    // max replans per second, 0 for unlimited
+    qreal max_replan_rate_;
+    bool is_live_reference_;
+    bool is_free_final_time_;
+    bool is_warm_start_;
+    SOLVER_BACKEND solver_backend_;
+
+    QVector<EllipseData> ellipses_;
+    QVector<PolygonData> polygons_;
+    QVector<PlaneData> planes_;
+    QVector<QPointF> waypoints_;
+    // regions for ellipses to use for overlap detection
+    QVector<QRegion> ellipse_regions_;
+
+    // funtions for loading data into a trajectory problem.
+    // given a cache, only rebuild slots of items changed since P
+    // was last loaded with the same cache
+    void loadSkyeFlyParams(TrajectoryProblem *P, ParamsCache *cache) const;
+    void loadWaypointConstraints(TrajectoryProblem *P) const;
+    void loadEllipseConstraints(TrajectoryProblem *P,
+                                ParamsCache *cache = nullptr) const;
+    void loadPosConstraints(TrajectoryProblem *P,
+                            ParamsCache *cache = nullptr) const;
+
+ private:
+    // Convert constraints to problem constraints
+    void loadEllipseConstraint(TrajectoryProblem *P, quint32 index,
+                               EllipseData const &ellipse) const;
+    void loadPlaneConstraint(TrajectoryProblem *P, quint32 index,
+                             QVector3D p, QVector3D q) const;
+    int distributeWpEvenly(TrajectoryProblem *P, int index, int remaining,
+                           int low, int high) const;
+    // return whether item generation is already loaded in slot,
+    // otherwise record it. slots must be checked in order
+    static bool checkCachedSlot(QVector<QPair<DataModel *, quint64>> *slots,
+                                int slot, DataModel *item,
+                                quint64 generation);
+};
+
+}  // namespace optgui
+
+#endif  // SCENE_SNAPSHOT_H_
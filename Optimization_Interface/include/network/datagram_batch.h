@@ -0,0 +1,61 @@
+// TITLE:   Optimization_Interface/include/network/datagram_batch.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Reused buffers for reading many datagrams from a socket at once
+
+#ifndef DATAGRAM_BATCH_H_
+#define DATAGRAM_BATCH_H_
+
+#include <QUdpSocket>
+#include <QVector>
+
+#ifdef Q_OS_LINUX
+#include <sys/socket.h>
+#endif
+
+namespace optgui {
+
+class DatagramBatch {
+ public:
+    // datagrams read per batch
+    static qint32 const CAPACITY = 32;
+    // bytes kept per datagram, longer datagrams are truncated
+    static qint64 const DATAGRAM_SIZE = 4000;
+
+    // buffers allocated on first receive
+    DatagramBatch();
+
+    // read up to CAPACITY pending datagrams into slots, oldest first,
+    // returns number read. batch is full if more may be pending.
+    // must be called on thread socket lives on
+    qint32 receive(QUdpSocket *socket);
+    // datagram in slot, bytes past its size are zero as if
+    // read into an empty buffer
+    char const *getData(qint32 index) const;
+    qint64 getSize(qint32 index) const;
+
+ private:
+    // slots laid out back to back
+    QVector<char> buffer_;
+    // bytes read into each slot
+    QVector<qint64> sizes_;
+    // bytes possibly nonzero in each slot, cleared down to
+    // size of next datagram read into it
+    QVector<qint64> dirty_;
+#ifdef Q_OS_LINUX
+    // recvmmsg descriptors pointing at slots, set up once
+    QVector<mmsghdr> headers_;
+    QVector<iovec> iovecs_;
+#endif
+
+    void allocate();
+    char *getSlot(qint32 index);
+    // zero bytes left in slot by longer earlier datagram
+    void setSize(qint32 index, qint64 size);
+};
+
+}  // namespace optgui
+
+#endif  // DATAGRAM_BATCH_H_
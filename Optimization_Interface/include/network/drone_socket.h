@@ -8,41 +8,58 @@
 #ifndef DRONE_SOCKET_H_
 #define DRONE_SOCKET_H_
 
-#include <QUdpSocket>
+#include <QSharedPointer>
 
 #include "autogen/lib.h"
 
 #include "include/graphics/drone_graphics_item.h"
+#include "include/network/telemetry_socket.h"
 
 namespace optgui {
 
-class DroneSocket : public QUdpSocket {
+// executed traj shared with drone sockets on network thread
+// without copying it for each socket
+typedef QSharedPointer<autogen::packet::traj3dof const> Traj3dofPtr;
+
+class DroneSocket : public TelemetrySocket {
     Q_OBJECT
 
  public:
+    // unbound until added to network thread
     explicit DroneSocket(DroneGraphicsItem *item, QObject *parent = nullptr);
     ~DroneSocket();
 
     // graphic item to manipulate over network
     DroneGraphicsItem *drone_item_;
 
- private slots:
-    // automatically read incoming data with slots
-    void readPendingDatagrams();
-
- signals:
-    // signal to re-render vehicle
-    void refresh_graphics();
-
  public slots:
-    void rx_trajectory(DroneModelItem *drone,
-                       const autogen::packet::traj3dof data);
+    // send traj to drone if it is for this drone
+    void rx_trajectory(DroneModelItem *drone, Traj3dofPtr data);
+
+ protected:
+    // decode telemetry into pending telemetry
+    bool decodePacket(char const *buffer, qint64 size) override;
+    // set model telemetry to pending telemetry, true if changed
+    bool applyPacket() override;
 
  private:
+    DroneTelemetry pending_telemetry_;
+
+    // drone address resolved when socket is created,
+    // null if drone address or port is invalid
+    QHostAddress destination_addr_;
+    quint16 destination_port_;
+    // reused for every traj sent, only touched on network thread
+    autogen::serializable::traj3dof
+            <autogen::topic::traj3dof::UNDEFINED> tx_traj_;
+    char tx_buffer_[4096];
+
     // check if destination address is valid
     bool isDestinationAddrValid();
 };
 
 }  // namespace optgui
 
+Q_DECLARE_METATYPE(optgui::Traj3dofPtr)
+
 #endif  // DRONE_SOCKET_H_
@@ -9,18 +9,16 @@
 #ifndef ELLIPSE_SOCKET_H_
 #define ELLIPSE_SOCKET_H_
 
-#include <QUdpSocket>
-
-#include "autogen/lib.h"
-
 #include "include/graphics/ellipse_graphics_item.h"
+#include "include/network/telemetry_socket.h"
 
 namespace optgui {
 
-class EllipseSocket : public QUdpSocket {
+class EllipseSocket : public TelemetrySocket {
     Q_OBJECT
 
  public:
+    // unbound until added to network thread
     explicit EllipseSocket(EllipseGraphicsItem *item,
                            QObject *parent = nullptr);
     ~EllipseSocket();
@@ -28,13 +26,14 @@ class EllipseSocket : public QUdpSocket {
     // ellipse obstacle to manipulate over network
     EllipseGraphicsItem *ellipse_item_;
 
- signals:
-    // signal to re-render ellipse
-    void refresh_graphics();
+ protected:
+    // decode telemetry pos into pending pos
+    bool decodePacket(char const *buffer, qint64 size) override;
+    // set model pos to pending pos, true if moved
+    bool applyPacket() override;
 
- private slots:
-    // automatically read incoming data with slots
-    void readPendingDatagrams();
+ private:
+    QPointF pending_pos_;
 };
 
 }  // namespace optgui
@@ -0,0 +1,52 @@
+// TITLE:   Optimization_Interface/include/network/network_thread.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Thread running socket I/O and packet decoding off the gui thread
+
+#ifndef NETWORK_THREAD_H_
+#define NETWORK_THREAD_H_
+
+#include <QThread>
+#include <QUdpSocket>
+
+namespace optgui {
+
+// lives on network thread so sockets are bound and deleted there
+class NetworkWorker : public QObject {
+    Q_OBJECT
+
+ public slots:
+    void bindSocket(QUdpSocket *socket, quint16 port);
+    void deleteSocket(QUdpSocket *socket);
+};
+
+// Sockets added here read and decode packets on this thread and
+// write decoded state straight into their models, so telemetry
+// latency does not depend on the gui event loop.
+// Sockets must only signal the gui thread through queued
+// connections that carry no graphics item pointers, since items
+// can be deleted before queued signals are handled.
+class NetworkThread : public QThread {
+    Q_OBJECT
+
+ public:
+    explicit NetworkThread(QObject *parent = nullptr);
+    // stop event loop, remove sockets before deleting
+    ~NetworkThread();
+
+    // move unbound socket with no parent to network thread and
+    // bind it there if port is not 0, blocking until bound
+    void addSocket(QUdpSocket *socket, quint16 port);
+    // delete socket on network thread, blocking until deleted so
+    // models it writes to can be deleted after
+    void removeSocket(QUdpSocket *socket);
+
+ private:
+    NetworkWorker *worker_;
+};
+
+}  // namespace optgui
+
+#endif  // NETWORK_THREAD_H_
@@ -8,18 +8,16 @@
 #ifndef POINT_SOCKET_H_
 #define POINT_SOCKET_H_
 
-#include <QUdpSocket>
-
-#include "autogen/lib.h"
-
 #include "include/graphics/point_graphics_item.h"
+#include "include/network/telemetry_socket.h"
 
 namespace optgui {
 
-class PointSocket : public QUdpSocket {
+class PointSocket : public TelemetrySocket {
     Q_OBJECT
 
  public:
+    // unbound until added to network thread
     explicit PointSocket(PointGraphicsItem *item,
                          QObject *parent = nullptr);
     ~PointSocket();
@@ -27,13 +25,14 @@ class PointSocket : public QUdpSocket {
     // target point to manipulate over network
     PointGraphicsItem *point_item_;
 
- signals:
-    // signal to re-render target point graphic
-    void refresh_graphics();
+ protected:
+    // decode telemetry pos into pending pos
+    bool decodePacket(char const *buffer, qint64 size) override;
+    // set model pos to pending pos, true if moved
+    bool applyPacket() override;
 
- private slots:
-    // automatically read incoming data with slots
-    void readPendingDatagrams();
+ private:
+    QPointF pending_pos_;
 };
 
 }  // namespace optgui
@@ -0,0 +1,63 @@
+// TITLE:   Optimization_Interface/include/network/telemetry_mux.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// UDP Socket receiving telemetry for all objects on one port
+
+#ifndef TELEMETRY_MUX_H_
+#define TELEMETRY_MUX_H_
+
+#include <QUdpSocket>
+#include <QHash>
+#include <QMutex>
+
+#include "include/network/datagram_batch.h"
+#include "include/network/telemetry_socket.h"
+
+namespace optgui {
+
+// Packets start with a 2 byte big endian object id and a 4 byte big
+// endian sequence number followed by the telemetry packet. The id of
+// an object is its configured listening port, so senders keep the ids
+// they used in per port mode. Sequence numbers count up per object
+// and are used to drop reordered packets and count lost ones.
+class TelemetryMux : public QUdpSocket {
+    Q_OBJECT
+
+ public:
+    // unbound until added to network thread
+    explicit TelemetryMux(QObject *parent = nullptr);
+    ~TelemetryMux();
+
+    // route packets with id to unbound socket for decoding
+    void addRoute(quint16 id, TelemetrySocket *socket);
+    // stop routing to socket, blocks until any packet being
+    // decoded by it is done so it can be deleted after
+    void removeRoute(TelemetrySocket *socket);
+
+ signals:
+    // signal gui to sync graphics to models on next frame,
+    // emitted on network thread
+    void refresh_graphics();
+
+ private slots:
+    // automatically read incoming data with slots
+    void readPendingDatagrams();
+
+ private:
+    // mutex lock for routes, routes change on gui thread
+    QMutex mutex_;
+    // object id to socket decoding its packets
+    QHash<quint16, TelemetrySocket *> routes_;
+    // reused receive buffers, only touched on network thread
+    DatagramBatch batch_;
+
+    // apply freshest valid packet for each object in batch,
+    // true if any model changed
+    bool routeBatch(qint32 count);
+};
+
+}  // namespace optgui
+
+#endif  // TELEMETRY_MUX_H_
@@ -0,0 +1,101 @@
+// TITLE:   Optimization_Interface/include/network/telemetry_socket.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// UDP Socket base for decoding telemetry packets into one model
+
+#ifndef TELEMETRY_SOCKET_H_
+#define TELEMETRY_SOCKET_H_
+
+#include <QUdpSocket>
+#include <QMutex>
+#include <QElapsedTimer>
+
+#include "autogen/lib.h"
+
+#include "include/network/datagram_batch.h"
+
+namespace optgui {
+
+// Ingest counters for one object
+struct TelemetryStats {
+    TelemetryStats() : received(0), applied(0), superseded(0),
+        stale(0), malformed(0), lost(0), resyncs(0), jitter_msecs(0) {}
+
+    quint64 received;  // packets read for object
+    quint64 applied;  // samples written to model
+    quint64 superseded;  // samples replaced by newer one in same batch
+    quint64 stale;  // reordered or repeated packets already passed
+    quint64 malformed;  // packets that did not deserialize
+    quint64 lost;  // sequence numbers never received
+    quint64 resyncs;  // sender restarts, sequence jumped far back
+    qreal jitter_msecs;  // smoothed variation between sample arrivals
+};
+
+class TelemetrySocket : public QUdpSocket {
+    Q_OBJECT
+
+ public:
+    // unbound until added to network thread
+    explicit TelemetrySocket(QObject *parent = nullptr);
+    ~TelemetrySocket();
+
+    // Offer packet from a batch read newest first. Decoded into the
+    // pending sample only if newer than the pending and last applied
+    // samples, by sequence number if sender numbers packets,
+    // otherwise by arrival. A sequence number further behind than
+    // the reorder window is a restarted sender and resyncs. Called
+    // on network thread by this socket when bound, or by telemetry
+    // mux when routed through a shared port
+    void offerPacket(char const *buffer, qint64 size,
+                     bool has_sequence, quint32 sequence);
+    // write pending sample to model once per batch,
+    // true if model changed
+    bool applyPending();
+
+    TelemetryStats getTelemetryStats();
+
+ signals:
+    // signal gui to sync graphics to models on next frame,
+    // emitted on network thread
+    void refresh_graphics();
+
+ protected:
+    // decode telemetry packet into pending sample of subclass,
+    // pending sample left unchanged if packet does not deserialize
+    virtual bool decodePacket(char const *buffer, qint64 size) = 0;
+    // write pending sample to model, true if model changed
+    virtual bool applyPacket() = 0;
+
+ private slots:
+    // automatically read incoming data with slots
+    void readPendingDatagrams();
+
+ private:
+    // reused receive buffers, only touched on network thread
+    DatagramBatch batch_;
+
+    // mutex lock for ingest state, stats read on gui thread
+    QMutex mutex_;
+    TelemetryStats stats_;
+    bool has_pending_;
+    bool pending_has_sequence_;
+    quint32 pending_sequence_;
+    // newer sequenced packets offered since last apply
+    quint64 pending_received_;
+    bool has_applied_sequence_;
+    quint32 applied_sequence_;
+
+    // arrival times of applied samples for jitter
+    QElapsedTimer clock_;
+    qint64 last_arrival_nsecs_;
+    qint64 last_interval_nsecs_;
+
+    // sequence numbers wrap, newer if less than half range ahead
+    static bool isNewer(quint32 sequence, quint32 than);
+};
+
+}  // namespace optgui
+
+#endif  // TELEMETRY_SOCKET_H_
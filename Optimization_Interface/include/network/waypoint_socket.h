@@ -9,18 +9,16 @@
 #ifndef WAYPOINT_SOCKET_H_
 #define WAYPOINT_SOCKET_H_
 
-#include <QUdpSocket>
-
-#include "autogen/lib.h"
-
 #include "include/graphics/waypoint_graphics_item.h"
+#include "include/network/telemetry_socket.h"
 
 namespace optgui {
 
-class WaypointSocket : public QUdpSocket {
+class WaypointSocket : public TelemetrySocket {
     Q_OBJECT
 
  public:
+    // unbound until added to network thread
     explicit WaypointSocket(WaypointGraphicsItem *item,
                             QObject *parent = nullptr);
     ~WaypointSocket();
@@ -28,13 +26,14 @@ class WaypointSocket : public QUdpSocket {
     // waypoint to manipulate over network
     WaypointGraphicsItem *waypoint_item_;
 
- signals:
-    // signal to re-render waypoint graphic
-    void refresh_graphics();
+ protected:
+    // decode telemetry pos into pending pos
+    bool decodePacket(char const *buffer, qint64 size) override;
+    // set model pos to pending pos, true if moved
+    bool applyPacket() override;
 
- private slots:
-    // automatically read incoming data with slots
-    void readPendingDatagrams();
+ private:
+    QPointF pending_pos_;
 };
 
 }  // namespace optgui
@@ -0,0 +1,82 @@
+// TITLE:   Optimization_Interface/include/solvers/reference_solver.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Self contained double integrator solver for comparing backends.
+// Joins boundary conditions and waypoints with minimum acceleration
+// cubic segments, adding knots to bend traj out of obstacles and
+// onto the feasible side of planes. A baseline, not an optimal solve
+
+#ifndef REFERENCE_SOLVER_H_
+#define REFERENCE_SOLVER_H_
+
+#include "include/solvers/trajectory_solver.h"
+
+namespace optgui {
+
+class ReferenceSolver : public TrajectorySolver {
+ public:
+    ReferenceSolver();
+
+    void setProblem(TrajectoryProblem const &problem,
+                    TrajectoryInputs const &inputs) override;
+    void resetInputs() override;
+    void setInitialGuess(TrajectorySeed const &seed) override;
+    TrajectoryOutputs const &solve(bool free_final_time) override;
+
+ private:
+    // problem params
+    quint32 K_;
+    double tf_;
+    // final time of seed, first guess for free final time,
+    // 0 if not seeded
+    double seed_tf_;
+    double a_max_;
+    double v_max_;
+
+    // ellipse obstacles as M * (r - c) outside radius R
+    QVector<QVector3D> obs_center_;
+    QVector<QVector<double>> obs_matrix_;
+    QVector<double> obs_radius_;
+    // position constraints, traj stays where a . (y, x) >= b
+    QVector<HalfPlane> planes_;
+
+    // positions and times that traj must pass through,
+    // starting with initial pos and ending with final pos
+    QVector<QVector3D> base_knots_;
+    QVector<double> base_fractions_;
+    QVector3D v_i_;
+    // traj points pinned by boundary conditions and waypoints
+    QVector<bool> fixed_;
+
+    // base knots and knots added by last solve to avoid constraints
+    QVector<QVector3D> knots_;
+    QVector<double> knot_fractions_;
+    // traj points that no longer get knots added this solve
+    QVector<bool> skip_;
+
+    TrajectoryOutputs outputs_;
+
+    // sample traj for final time, return peak acceleration
+    double sample(double tf);
+    // add knots until sampled traj clears constraints,
+    // return peak acceleration of last sample
+    double avoidConstraints(double peak_accel);
+    // add or move knot at traj point pushed out of constraints,
+    // false if no traj point left to move
+    bool addAvoidanceKnot();
+    // nearest position to r clearing constraints
+    QVector3D project(QVector3D r) const;
+    // depth of r inside obstacle radius, or past plane in meters,
+    // 0 or less if clear
+    double obstacleDepth(int i, QVector3D const &r) const;
+    double planeDepth(int i, QVector3D const &r) const;
+    bool clearsPlanes(QVector3D const &r) const;
+    // score constraint and dynamics violations of sampled traj
+    double scoreViolation();
+};
+
+}  // namespace optgui
+
+#endif  // REFERENCE_SOLVER_H_
@@ -0,0 +1,51 @@
+// TITLE:   Optimization_Interface/include/solvers/skyefly_solver.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Trajectory solver backend running skyenet SCvx
+
+#ifndef SKYEFLY_SOLVER_H_
+#define SKYEFLY_SOLVER_H_
+
+#include "cprs.h"
+#include "algorithm.h"
+
+#include "include/solvers/trajectory_solver.h"
+
+namespace optgui {
+
+class SkyeFlySolver : public TrajectorySolver {
+ public:
+    SkyeFlySolver();
+
+    void setProblem(TrajectoryProblem const &problem,
+                    TrajectoryInputs const &inputs) override;
+    void resetInputs() override;
+    // no setInitialGuess, skyenet takes no initial guess so warm
+    // starts only keep its last SCvx solution and ignore the seed
+    TrajectoryOutputs const &solve(bool free_final_time) override;
+
+    // copy default skyenet params into problem
+    static void loadDefaults(TrajectoryProblem *problem);
+
+ private:
+    // problem data
+    skyenet::SkyeFly fly_;
+    // params converted from problem, kept so params
+    // not in problem keep skyenet defaults
+    skyenet::params P_;
+    // number of points in traj
+    quint32 K_;
+
+    // boundary conditions and waypoints of current problem,
+    // for resetting inputs
+    TrajectoryInputs inputs_;
+    double wp_[skyenet::MAX_WAYPOINTS][3];
+
+    TrajectoryOutputs outputs_;
+};
+
+}  // namespace optgui
+
+#endif  // SKYEFLY_SOLVER_H_
@@ -0,0 +1,82 @@
+// TITLE:   Optimization_Interface/include/solvers/trajectory_problem.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Solver independent trajectory problem, converted to backend
+// params only inside each solver
+
+#ifndef TRAJECTORY_PROBLEM_H_
+#define TRAJECTORY_PROBLEM_H_
+
+#include <QtGlobal>
+#include <QVector>
+
+namespace optgui {
+
+// problem size limits of the solvers built in
+extern quint32 const MAX_HORIZON;
+extern quint32 const MAX_WAYPOINTS;
+extern quint32 const MAX_OBS;
+extern quint32 const MAX_CPOS;
+
+// ellipse obstacle in xyz meters, traj stays where
+// M * (r - c) is outside radius R
+struct EllipseObstacle {
+    double c_x;
+    double c_y;
+    double M[2][2];
+    double R;
+};
+
+// half plane position constraint on x and y in xyz meters,
+// traj stays where a[0] * y + a[1] * x >= b
+struct HalfPlane {
+    double a[2];
+    double b;
+};
+
+// waypoint in xyz meters and index of traj point passing through it
+struct TrajectoryWaypoint {
+    double r[3];
+    quint32 index;
+};
+
+struct TrajectoryProblem {
+    // defaults of the skyefly backend, or of the reference
+    // solver when built without skyenet
+    TrajectoryProblem();
+
+    // number of points in traj
+    quint32 K;
+    // final time in seconds
+    double tf;
+
+    // dynamics limits
+    double a_min;
+    double a_max;
+    double v_max;
+    double v_max_slow;
+    double theta_max;
+    double j_max;
+
+    // skyefly SCvx settings
+    double delta;
+    quint32 max_iter;
+    double lambda;
+    double ri_relax;
+    double rf_relax;
+    double wp_relax;
+    double trust_tau_weight;
+    double trust_delta_weight;
+
+    // constraints, at most MAX_OBS obstacles and MAX_CPOS planes
+    QVector<EllipseObstacle> obstacles;
+    QVector<HalfPlane> planes;
+    // at most MAX_WAYPOINTS, in order along traj
+    QVector<TrajectoryWaypoint> waypoints;
+};
+
+}  // namespace optgui
+
+#endif  // TRAJECTORY_PROBLEM_H_
@@ -0,0 +1,84 @@
+// TITLE:   Optimization_Interface/include/solvers/trajectory_solver.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Interface for trajectory solver backends used by drone planners
+
+#ifndef TRAJECTORY_SOLVER_H_
+#define TRAJECTORY_SOLVER_H_
+
+#include <QVector>
+#include <QVector3D>
+
+#include "include/globals.h"
+#include "include/solvers/trajectory_problem.h"
+
+namespace optgui {
+
+// solved trajectory in xyz meters
+struct TrajectoryOutputs {
+    TrajectoryOutputs() : violation(0), iterations(0) {}
+
+    // time of each point in seconds
+    QVector<double> t;
+    QVector<QVector3D> r;
+    QVector<QVector3D> v;
+    QVector<QVector3D> a;
+    // sum of squared constraint violations, infeasible above
+    // FEASIBILITY_TOLERANCE
+    double violation;
+    // solver iterations, 0 if backend does not report them
+    quint32 iterations;
+};
+
+// rest of previous traj from drone's progress along it
+struct TrajectorySeed {
+    // time of each point in seconds from now
+    QVector<double> t;
+    // positions in xyz meters
+    QVector<QVector3D> r;
+};
+
+// boundary conditions in xyz meters
+struct TrajectoryInputs {
+    TrajectoryInputs();
+    // convert drone state and final pos from gui coords
+    TrajectoryInputs(QVector3D const &initial_pos,
+                     QVector3D const &initial_vel,
+                     QVector3D const &initial_acc,
+                     QVector3D const &final_pos);
+
+    double r_i[3];
+    double v_i[3];
+    double a_i[3];
+    double r_f[3];
+};
+
+class TrajectorySolver {
+ public:
+    virtual ~TrajectorySolver() {}
+
+    // create solver for backend, caller responsible for deleting pointer.
+    // skyefly backend falls back to reference solver when built
+    // without skyenet
+    static TrajectorySolver *create(SOLVER_BACKEND backend);
+
+    // set problem and boundary conditions in xyz meters
+    virtual void setProblem(TrajectoryProblem const &problem,
+                            TrajectoryInputs const &inputs) = 0;
+    // discard previous solution and start from initial guess
+    virtual void resetInputs() = 0;
+    // seed next solve with previous traj instead of resetting inputs,
+    // only used by reference solver, skyefly keeps its own solution
+    // between solves and ignores it
+    virtual void setInitialGuess(TrajectorySeed const &seed) {
+        Q_UNUSED(seed);
+    }
+    // solve for free or fixed final time
+    virtual TrajectoryOutputs const &solve(bool free_final_time) = 0;
+};
+
+}  // namespace optgui
+
+#endif  // TRAJECTORY_SOLVER_H_
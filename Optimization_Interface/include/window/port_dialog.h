@@ -10,6 +10,8 @@
 
 #include <QDialog>
 #include <QTableWidget>
+#include <QCheckBox>
+#include <QSpinBox>
 
 #include "include/models/constraint_model.h"
 
@@ -24,6 +26,9 @@ class PortDialog : public QDialog {
 
     // fill table from the model
     void fillTable(ConstraintModel *model);
+    // port receiving all telemetry, 0 if each object
+    // listens on its own port
+    quint16 getMuxPort();
     // save network configuration to data models on close
     void closeEvent(QCloseEvent *event) override;
 
@@ -44,6 +49,9 @@ class PortDialog : public QDialog {
     QTableWidget *drone_table_;
     // currently used ports, shared between all input boxes
     QSet<quint16> *ports_;
+    // single port mode, packets routed by object listening port
+    QCheckBox *mux_toggle_;
+    QSpinBox *mux_port_;
 };
 
 }  // namespace optgui
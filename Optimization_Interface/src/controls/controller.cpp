@@ -10,6 +10,7 @@
 #include <QTranslator>
 #include <QSet>
 #include <QDate>
+#include <QDateTime>
 #include <QTextStream>
 #include <QString>
 
@@ -22,6 +23,7 @@
 #include "include/graphics/plane_graphics_item.h"
 #include "include/graphics/polygon_resize_handle.h"
 #include "include/graphics/path_graphics_item.h"
+#include "include/graphics/path_history_graphics_item.h"
 #include "include/graphics/drone_graphics_item.h"
 #include "include/graphics/waypoint_graphics_item.h"
 #include "include/globals.h"
@@ -33,6 +35,10 @@ Controller::Controller(Canvas *canvas) {
     this->canvas_ = canvas;
     this->model_ = new ConstraintModel();
 
+    // start replanning for drones as they are added
+    this->scheduler_ = new ReplanScheduler(this->model_);
+    this->scheduler_->start();
+
     // set rendering order
     qreal renderLevel = std::numeric_limits<qreal>::max();
 
@@ -62,6 +68,14 @@ Controller::Controller(Canvas *canvas) {
     this->traj_render_level_ = renderLevel;
     renderLevel = std::nextafter(renderLevel, 0);
 
+    // initialize trajectory history graphic render level
+    this->history_render_level_ = renderLevel;
+    renderLevel = std::nextafter(renderLevel, 0);
+
+    // socket io runs on its own thread
+    this->network_thread_ = new NetworkThread();
+    this->telemetry_mux_ = nullptr;
+
     // initialize port dialog
     this->port_dialog_ = new PortDialog();
     connect(this->port_dialog_, SIGNAL(setSocketPorts()),
@@ -82,20 +96,23 @@ Controller::Controller(Canvas *canvas) {
 }
 
 Controller::~Controller() {
-    for (ComputeThread *thread : this->compute_threads_) {
-        thread->stopCompute();
-        // delete should be handled by deletelater slot
-//        thread->quit();
-//        thread->wait();
-//        delete thread;
+    // stop all planners so queued computes return early
+    for (DronePlanner *planner : this->planners_) {
+        planner->stopCompute();
     }
-    this->compute_threads_.clear();
+    this->scheduler_->stopScheduler();
+    delete this->scheduler_;
+    for (DronePlanner *planner : this->planners_) {
+        delete planner;
+    }
+    this->planners_.clear();
 
     // deinitialize port dialog
     delete this->port_dialog_;
 
     // deinitialize network
     this->closeSockets();
+    delete this->network_thread_;
 
     // clean up model
     delete this->model_;
@@ -117,6 +134,9 @@ void Controller::setFinaltime(qreal final_time) {
 // ============ MOUSE CONTROLS ============
 
 void Controller::removeItem(QGraphicsItem *item) {
+    // drop pending renders of deleted graphic
+    this->canvas_->render_scheduler_->removeItem(item);
+
     // switch based on custom graphics type
     switch (item->type()) {
         case DRONE_GRAPHIC: {
@@ -133,25 +153,40 @@ void Controller::removeItem(QGraphicsItem *item) {
             this->model_->setLiveReferenceMode(false);
             this->unsetStagedPath();
 
-            // remove compute thread
-            QMap<DroneModelItem *, ComputeThread *>::iterator iter =
-                    this->compute_threads_.find(model);
-            if (iter != this->compute_threads_.end()) {
+            // remove planner
+            QMap<DroneModelItem *, DronePlanner *>::iterator iter =
+                    this->planners_.find(model);
+            if (iter != this->planners_.end()) {
                 // get traj
                 PathGraphicsItem *traj = (*iter)->getTrajGraphic();
                 PathModelItem *traj_model = traj->model_;
+                PathHistoryModelItem *history = (*iter)->getHistory();
 
-                // stop compute
-                (*iter)->stopCompute();
-                // deletion will be handled by deletelater slot
+                // stop compute, waits for running compute to finish
+                this->scheduler_->removePlanner(*iter);
+                // delete after queued signals are handled
+                (*iter)->deleteLater();
                 // remove from map
-                iter = this->compute_threads_.erase(iter);
+                iter = this->planners_.erase(iter);
 
                 // remove traj
+                this->canvas_->render_scheduler_->removeItem(traj);
                 this->canvas_->removeItem(traj);
                 this->canvas_->path_graphics_.remove(traj);
                 delete traj;
                 delete traj_model;
+
+                // remove traj history overlay, model deleted with planner
+                for (PathHistoryGraphicsItem *history_graphic :
+                     this->canvas_->history_graphics_) {
+                    if (history_graphic->model_ == history) {
+                        this->canvas_->removeItem(history_graphic);
+                        this->canvas_->history_graphics_.remove(
+                                    history_graphic);
+                        delete history_graphic;
+                        break;
+                    }
+                }
             }
 
             // remove drone
@@ -172,9 +207,9 @@ void Controller::removeItem(QGraphicsItem *item) {
                     PointGraphicsItem *>(item);
             // get data model
             PointModelItem *model = point->model_;
-            for (ComputeThread *thread : this->compute_threads_.values()) {
-                if (model == thread->getTarget()) {
-                    thread->setTarget(nullptr);
+            for (DronePlanner *planner : this->planners_.values()) {
+                if (model == planner->getTarget()) {
+                    planner->setTarget(nullptr);
                 }
             }
             // delete network socket
@@ -265,8 +300,8 @@ void Controller::removeItem(QGraphicsItem *item) {
             }
 
             // update all traj's to no have waypoint
-            for (ComputeThread *thread : this->compute_threads_) {
-                thread->reInit();
+            for (DronePlanner *planner : this->planners_) {
+                planner->reInit();
             }
 
             break;
@@ -416,6 +451,12 @@ void Controller::updateMessage(DroneModelItem *drone) {
     }
 }
 
+void Controller::updateStats(DroneModelItem *drone) {
+    if (this->model_->isCurrDrone(drone)) {
+        emit this->updateStats();
+    }
+}
+
 void Controller::freeze_traj() {
     // compute time difference between each point on traj
     int msec = (1000 * this->model_->getFinaltime()) /
@@ -445,6 +486,7 @@ void Controller::setStagedPath() {
     this->setStagedDrone(this->model_->getStagedDrone());
     this->canvas_->path_staged_graphic_->setColor(GREEN);
     // re-render staged traj
+    this->canvas_->path_staged_graphic_->syncFromModel();
     this->canvas_->path_staged_graphic_->update(
                 this->canvas_->path_staged_graphic_->boundingRect());
 }
@@ -456,6 +498,7 @@ void Controller::unsetStagedPath() {
         drone->is_staged_drone_ = false;
         drone->is_executed_drone_ = false;
     }
+    this->canvas_->path_staged_graphic_->syncFromModel();
     this->canvas_->path_staged_graphic_->update(
                 this->canvas_->path_staged_graphic_->boundingRect());
 }
@@ -484,19 +527,19 @@ void Controller::tickLiveReference() {
                                            traj.pos_ned(1, index),
                                            traj.pos_ned(2, index));
 
-            staged_drone->
-                    setVel(nedToGuiXyz(traj.vel_ned(0, index),
-                                       traj.vel_ned(1, index),
-                                       traj.vel_ned(2, index)));
-            staged_drone->
-                    setAccel(nedToGuiXyz(traj.accl_ned(0, index),
-                                         traj.accl_ned(1, index),
-                                         traj.accl_ned(2, index)));
-
-            // set model pos
-            staged_drone->setPos(coords);
-            // set graphic pos so view knows to draw offscreen
-            drone->setPos(QPointF(coords.x(), coords.y()));
+            // set model telem in one write
+            DroneTelemetry telemetry;
+            telemetry.pos = coords;
+            telemetry.vel = nedToGuiXyz(traj.vel_ned(0, index),
+                                        traj.vel_ned(1, index),
+                                        traj.vel_ned(2, index));
+            telemetry.accel = nedToGuiXyz(traj.accl_ned(0, index),
+                                          traj.accl_ned(1, index),
+                                          traj.accl_ned(2, index));
+            telemetry.timestamp = QDateTime::currentMSecsSinceEpoch();
+            staged_drone->setTelemetry(telemetry);
+            // move graphic so view knows to draw offscreen
+            drone->syncFromModel();
         }
 
         // update output file
@@ -522,6 +565,7 @@ void Controller::tickLiveReference() {
         this->unsetStagedPath();
     }
     // re-render staged traj
+    this->canvas_->path_staged_graphic_->syncFromModel();
     this->canvas_->path_staged_graphic_->update(
                 this->canvas_->path_staged_graphic_->boundingRect());
 }
@@ -546,15 +590,14 @@ void Controller::execute() {
         }
 
         // find traj and set it
-        QMap<DroneModelItem *, ComputeThread *>::iterator iter =
-                this->compute_threads_.find(staged_drone);
-        if (iter != this->compute_threads_.end()) {
+        QMap<DroneModelItem *, DronePlanner *>::iterator iter =
+                this->planners_.find(staged_drone);
+        if (iter != this->planners_.end()) {
             (*iter)->getTrajGraphic()->model_->
                     setPoints(this->model_->getPathStagedPoints());
         }
 
-        emit trajectoryExecuted(staged_drone,
-                                this->model_->getStagedTraj3dof());
+        this->sendStagedTraj(staged_drone);
     } else if (this->freeze_traj_timer_->isActive() &&
                !this->traj_lock_ &&
                this->model_->getIsValidTraj() == FEASIBILITY_CODE::FEASIBLE) {
@@ -563,11 +606,17 @@ void Controller::execute() {
         this->canvas_->path_staged_graphic_->setColor(CYAN);
         // this->model_->setPathPoints(this->model_->getPathStagedPoints());
 
-        emit trajectoryExecuted(staged_drone,
-                                this->model_->getStagedTraj3dof());
+        this->sendStagedTraj(staged_drone);
     }
 }
 
+void Controller::sendStagedTraj(DroneModelItem *staged_drone) {
+    // one copy of staged traj shared by all drone sockets
+    Traj3dofPtr traj(new autogen::packet::traj3dof(
+                         this->model_->getStagedTraj3dof()));
+    emit trajectoryExecuted(staged_drone, traj);
+}
+
 void Controller::createOutputFile() {
     // close old output file if exists
     if (this->output_file_ != nullptr) {
@@ -618,9 +667,10 @@ void Controller::updateOutputFile(autogen::packet::traj3dof const &traj, DroneMo
            << traj.accl_ned(0, index) << "," << traj.accl_ned(1, index) << "," << traj.accl_ned(2, index) << ",";
 
     // telem
-    QVector3D pos_telem_ned(guiXyzToNED(staged_drone->getPos()));
-    QVector3D vel_telem_ned(guiXyzToNED(staged_drone->getVel()));
-    QVector3D accl_telem_ned(guiXyzToNED(staged_drone->getAccel()));
+    DroneTelemetry telemetry = staged_drone->getTelemetry();
+    QVector3D pos_telem_ned(guiXyzToNED(telemetry.pos));
+    QVector3D vel_telem_ned(guiXyzToNED(telemetry.vel));
+    QVector3D accl_telem_ned(guiXyzToNED(telemetry.accel));
     stream << pos_telem_ned.x() << "," << pos_telem_ned.y() << "," << pos_telem_ned.z() << ","
            << vel_telem_ned.x() << "," << vel_telem_ned.y() << "," << vel_telem_ned.z() << ","
            << accl_telem_ned.x() << "," << accl_telem_ned.y() << "," << accl_telem_ned.z() << ",";
@@ -663,6 +713,14 @@ void Controller::setFreeFinalTime(bool state) {
     this->model_->setFreeFinalTime(state);
 }
 
+void Controller::setWarmStart(bool state) {
+    this->model_->setWarmStart(state);
+}
+
+void Controller::setSolverBackend(SOLVER_BACKEND backend) {
+    this->model_->setSolverBackend(backend);
+}
+
 void Controller::setDataCapture(bool state) {
     // close current output file when switching modes
     if (state != this->capture_data_ && this->output_file_ != nullptr) {
@@ -687,18 +745,28 @@ void Controller::startSockets() {
     // close old sockets
     this->closeSockets();
 
+    // receive all telemetry on one port if configured
+    quint16 mux_port = this->port_dialog_->getMuxPort();
+    if (mux_port > 0) {
+        this->telemetry_mux_ = new TelemetryMux();
+        connect(this->telemetry_mux_,
+                SIGNAL(refresh_graphics()),
+                this->canvas_->render_scheduler_,
+                SLOT(requestSync()));
+        this->network_thread_->addSocket(this->telemetry_mux_, mux_port);
+    }
+
     // create drone sockets
     for (DroneGraphicsItem *graphic : this->canvas_->drone_graphics_) {
         if (graphic->model_->port_ > 0) {
             DroneSocket *temp = new DroneSocket(graphic);
             connect(this,
                     SIGNAL(trajectoryExecuted(DroneModelItem *,
-                                             const autogen::packet::traj3dof)),
+                                              Traj3dofPtr)),
                     temp,
-                    SLOT(rx_trajectory(DroneModelItem *,
-                                       const autogen::packet::traj3dof)));
-            connect(temp, SIGNAL(refresh_graphics()),
-                    this->canvas_, SLOT(update()));
+                    SLOT(rx_trajectory(DroneModelItem *, Traj3dofPtr)));
+            // read packets on network thread
+            this->addTelemetrySocket(temp, graphic->model_->port_);
             this->drone_sockets_.append(temp);
         }
     }
@@ -707,8 +775,8 @@ void Controller::startSockets() {
     for (PointGraphicsItem *graphic : this->canvas_->final_points_) {
         if (graphic->model_->port_ > 0) {
             PointSocket *temp = new PointSocket(graphic);
-            connect(temp, SIGNAL(refresh_graphics()),
-                    this->canvas_, SLOT(update()));
+            // read packets on network thread
+            this->addTelemetrySocket(temp, graphic->model_->port_);
             this->final_point_sockets_.append(temp);
         }
     }
@@ -717,8 +785,8 @@ void Controller::startSockets() {
     for (WaypointGraphicsItem *graphic : this->canvas_->waypoint_graphics_) {
         if (graphic->model_->port_ > 0) {
             WaypointSocket *temp = new WaypointSocket(graphic);
-            connect(temp, SIGNAL(refresh_graphics()),
-                    this->canvas_, SLOT(update()));
+            // read packets on network thread
+            this->addTelemetrySocket(temp, graphic->model_->port_);
             this->waypoint_sockets_.append(temp);
         }
     }
@@ -727,35 +795,63 @@ void Controller::startSockets() {
     for (EllipseGraphicsItem *graphic : this->canvas_->ellipse_graphics_) {
         if (graphic->model_->port_ > 0) {
             EllipseSocket *temp = new EllipseSocket(graphic);
-            connect(temp, SIGNAL(refresh_graphics()),
-                    this->canvas_, SLOT(update()));
+            // read packets on network thread
+            this->addTelemetrySocket(temp, graphic->model_->port_);
             this->ellipse_sockets_.append(temp);
         }
     }
 }
 
+void Controller::addTelemetrySocket(TelemetrySocket *socket,
+                                    quint16 port) {
+    if (this->telemetry_mux_) {
+        // decode packets routed by mux, socket left unbound
+        this->network_thread_->addSocket(socket, 0);
+        this->telemetry_mux_->addRoute(port, socket);
+    } else {
+        connect(socket,
+                SIGNAL(refresh_graphics()),
+                this->canvas_->render_scheduler_,
+                SLOT(requestSync()));
+        this->network_thread_->addSocket(socket, port);
+    }
+}
+
+void Controller::removeTelemetrySocket(TelemetrySocket *socket) {
+    if (this->telemetry_mux_) {
+        this->telemetry_mux_->removeRoute(socket);
+    }
+    this->network_thread_->removeSocket(socket);
+}
+
 void Controller::closeSockets() {
+    // close shared port first so nothing is routed to closed sockets
+    if (this->telemetry_mux_) {
+        this->network_thread_->removeSocket(this->telemetry_mux_);
+        this->telemetry_mux_ = nullptr;
+    }
+
     // close drone sockets
     for (DroneSocket *socket : this->drone_sockets_) {
-        delete socket;
+        this->removeTelemetrySocket(socket);
     }
     this->drone_sockets_.clear();
 
     // close final point sockets
     for (PointSocket *socket : this->final_point_sockets_) {
-        delete socket;
+        this->removeTelemetrySocket(socket);
     }
     this->final_point_sockets_.clear();
 
     // close waypoint sockets
     for (WaypointSocket *socket : this->waypoint_sockets_) {
-        delete socket;
+        this->removeTelemetrySocket(socket);
     }
     this->waypoint_sockets_.clear();
 
     // close ellipse sockets
     for (EllipseSocket *socket : this->ellipse_sockets_) {
-        delete socket;
+        this->removeTelemetrySocket(socket);
     }
     this->ellipse_sockets_.clear();
 }
@@ -768,7 +864,7 @@ void Controller::removeEllipseSocket(EllipseModelItem *model) {
 
     for (EllipseSocket *socket : this->ellipse_sockets_) {
         if (socket->ellipse_item_->model_ == model) {
-            delete socket;
+            this->removeTelemetrySocket(socket);
             found = true;
             break;
         }
@@ -788,7 +884,7 @@ void Controller::removePointSocket(PointModelItem *model) {
 
     for (PointSocket *socket : this->final_point_sockets_) {
         if (socket->point_item_->model_ == model) {
-            delete socket;
+            this->removeTelemetrySocket(socket);
             found = true;
             break;
         }
@@ -806,7 +902,7 @@ void Controller::removeDroneSocket(DroneModelItem *model) {
 
     for (DroneSocket *socket : this->drone_sockets_) {
         if (socket->drone_item_->model_ == model) {
-            delete socket;
+            this->removeTelemetrySocket(socket);
             found = true;
             break;
         }
@@ -826,7 +922,7 @@ void Controller::removeWaypointSocket(PointModelItem *model) {
 
     for (WaypointSocket *socket : this->waypoint_sockets_) {
         if (socket->waypoint_item_->model_ == model) {
-            delete socket;
+            this->removeTelemetrySocket(socket);
             found = true;
             break;
         }
@@ -917,27 +1013,38 @@ void Controller::loadDrone(DroneModelItem *item_model) {
     this->canvas_->path_graphics_.insert(path_graphic_);
     this->canvas_->addItem(path_graphic_);
 
-    // create compute thread
-    ComputeThread *compute_thread_ =
-            new ComputeThread(this->model_, item_graphic, path_graphic_);
-    this->compute_threads_.insert(item_model, compute_thread_);
-    connect(compute_thread_,
+    // create planner
+    DronePlanner *planner =
+            new DronePlanner(this->model_, item_graphic, path_graphic_);
+    this->planners_.insert(item_model, planner);
+
+    // create traj history overlay under traj
+    PathHistoryGraphicsItem *history_graphic =
+            new PathHistoryGraphicsItem(planner->getHistory());
+    history_graphic->setZValue(this->history_render_level_);
+    this->canvas_->history_graphics_.insert(history_graphic);
+    this->canvas_->addItem(history_graphic);
+    connect(planner,
             SIGNAL(updateGraphics(PathGraphicsItem *, DroneGraphicsItem *)),
             this->canvas_,
             SLOT(updateGraphicsItems(PathGraphicsItem *, DroneGraphicsItem *)));
-    connect(compute_thread_,
+    connect(planner,
             SIGNAL(finalTime(DroneModelItem *, qreal)),
             this,
             SLOT(finalTime(DroneModelItem *, qreal)));
-    connect(compute_thread_,
+    connect(planner,
             SIGNAL(updateMessage(DroneModelItem *)),
             this,
             SLOT(updateMessage(DroneModelItem *)));
-    connect(compute_thread_,
-            SIGNAL(finished()),
-            compute_thread_,
-            SLOT(deleteLater()));
-    compute_thread_->start();
+    connect(planner,
+            SIGNAL(updateStats(DroneModelItem *)),
+            this,
+            SLOT(updateStats(DroneModelItem *)));
+    connect(planner,
+            SIGNAL(updateEllipseColors()),
+            this->canvas_,
+            SLOT(updateEllipseGraphics()));
+    this->scheduler_->addPlanner(planner);
 }
 
 void Controller::loadWaypoint(PointModelItem *item_model) {
@@ -955,8 +1062,8 @@ void Controller::loadWaypoint(PointModelItem *item_model) {
     item_graphic->update(item_graphic->boundingRect());
 
     // update all traj's with new waypoint
-    for (ComputeThread *thread : this->compute_threads_) {
-        thread->reInit();
+    for (DronePlanner *planner : this->planners_) {
+        planner->reInit();
     }
 }
 
@@ -969,11 +1076,15 @@ void Controller::setClearance(qreal clearance) {
     this->model_->setClearance(clearance);
 }
 
+void Controller::setMaxReplanRate(qreal rate) {
+    this->model_->setMaxReplanRate(rate);
+}
+
 void Controller::setCurrFinalPoint(PointModelItem *point) {
     if (this->model_->getCurrDrone()) {
-        QMap<DroneModelItem *, ComputeThread *>::iterator iter =
-                this->compute_threads_.find(this->model_->getCurrDrone());
-        if (iter != this->compute_threads_.end()) {
+        QMap<DroneModelItem *, DronePlanner *>::iterator iter =
+                this->planners_.find(this->model_->getCurrDrone());
+        if (iter != this->planners_.end()) {
             (*iter)->setTarget(point);
         }
     }
@@ -1004,4 +1115,76 @@ INPUT_CODE Controller::getIsValidInput() {
     return this->model_->getIsValidInput();
 }
 
+PlannerStats Controller::getCurrPlannerStats() {
+    QMap<DroneModelItem *, DronePlanner *>::iterator iter =
+            this->planners_.find(this->model_->getCurrDrone());
+    if (iter != this->planners_.end()) {
+        return (*iter)->getPlannerStats();
+    }
+    return PlannerStats();
+}
+
+TelemetryStats Controller::getCurrTelemetryStats() {
+    DroneModelItem *drone = this->model_->getCurrDrone();
+    for (DroneSocket *socket : this->drone_sockets_) {
+        if (socket->drone_item_->model_ == drone) {
+            return socket->getTelemetryStats();
+        }
+    }
+    return TelemetryStats();
+}
+
+QString Controller::dumpPlannerStats() {
+    // create file in same directory as executable
+    QString filename = QDate::currentDate().toString("'stats_'MM_dd_yyyy'");
+    filename.append(QTime::currentTime().toString("'_'hh.mm.ss'.csv'"));
+
+    QFile file(filename);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return QString();
+    }
+    QTextStream stream(&file);
+
+    stream << "drone_port,stage,count,p50_ms,p95_ms,p99_ms,"
+           << "replan_hz,mean_iterations,infeasible_rate,iterations_saved"
+           << endl;
+
+    // one row per stage for each drone, then total and
+    // solve stage of warm and cold starts
+    for (DronePlanner *planner : this->planners_) {
+        PlannerStats stats = planner->getPlannerStats();
+        for (int i = 0; i < NUM_PLAN_STAGES + 3; i++) {
+            PLAN_STAGE stage = PLAN_STAGE(i);
+            QString name = PlannerStats::getStageName(stage);
+            LatencyHistogram const *histogram = &stats.getTotal();
+            if (i < NUM_PLAN_STAGES) {
+                histogram = &stats.getStage(stage);
+            } else if (i == NUM_PLAN_STAGES + 1) {
+                name = "warm_solve";
+                histogram = &stats.getWarmSolve();
+            } else if (i == NUM_PLAN_STAGES + 2) {
+                name = "cold_solve";
+                histogram = &stats.getColdSolve();
+            }
+            stream << planner->getDrone()->port_ << ","
+                   << name << ","
+                   << histogram->getCount() << ","
+                   << histogram->percentile(0.50) / 1e6 << ","
+                   << histogram->percentile(0.95) / 1e6 << ","
+                   << histogram->percentile(0.99) / 1e6 << ","
+                   << stats.getReplanRate() << ",";
+            // iteration columns empty if solver does not report them
+            if (stats.getMeanIterations() > 0) {
+                stream << stats.getMeanIterations();
+            }
+            stream << "," << stats.getInfeasibleRate() << ",";
+            if (stats.getMeanIterations() > 0) {
+                stream << stats.getIterationsSaved();
+            }
+            stream << endl;
+        }
+    }
+    return filename;
+}
+
 }  // namespace optgui
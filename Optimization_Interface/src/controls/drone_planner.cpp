@@ -0,0 +1,456 @@
+// TITLE:   Optimization_Interface/src/controls/drone_planner.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/drone_planner.h"
+#include "include/graphics/path_graphics_item.h"
+
+#include <algorithm>
+#include <QVector3D>
+#include <QtMath>
+
+namespace optgui {
+
+DronePlanner::DronePlanner(ConstraintModel *model,
+                           DroneGraphicsItem *drone,
+                           PathGraphicsItem *traj_graphic) :
+    solver_(TrajectorySolver::create(SKYEFLY_SOLVER)),
+    params_(), params_cache_(), history_(TRAJ_HISTORY_SIZE), mutex_() {
+    this->model_ = model;
+    this->backend_ = SKYEFLY_SOLVER;
+    // compute until stopped
+    this->run_loop_ = true;
+    this->drone_ = drone;
+    this->traj_graphic_ = traj_graphic;
+    this->target_ = nullptr;
+    this->target_changed_ = true;
+    this->scene_revision_ = 0;
+    this->drone_generation_ = 0;
+    this->target_generation_ = 0;
+    this->computed_target_ = nullptr;
+}
+
+DronePlanner::~DronePlanner() {
+    QMutexLocker locker(&this->mutex_);
+}
+
+void DronePlanner::stopCompute() {
+    // flag planner to discard results and skip further computes
+    QMutexLocker locker(&this->mutex_);
+    this->run_loop_ = false;
+}
+
+void DronePlanner::setTarget(PointModelItem *target) {
+    {
+        QMutexLocker locker(&this->mutex_);
+        if (target == this->target_) {
+            return;
+        }
+        this->target_changed_ = true;
+        this->target_ = target;
+    }
+    // wake scheduler to compute traj to new target
+    this->model_->notifyChange();
+}
+
+void DronePlanner::reInit() {
+    {
+        QMutexLocker locker(&this->mutex_);
+        this->target_changed_ = true;
+    }
+    // wake scheduler to reset inputs
+    this->model_->notifyChange();
+}
+
+PointModelItem *DronePlanner::getTarget() {
+    QMutexLocker locker(&this->mutex_);
+    return this->target_;
+}
+
+bool DronePlanner::getRunFlag() {
+    QMutexLocker locker(&this->mutex_);
+    return this->run_loop_;
+}
+
+PathHistoryModelItem *DronePlanner::getHistory() {
+    // history has its own lock
+    return &this->history_;
+}
+
+PathGraphicsItem *DronePlanner::getTrajGraphic() {
+    QMutexLocker locker(&this->mutex_);
+    return this->traj_graphic_;
+}
+
+DroneGraphicsItem *DronePlanner::getDroneGraphic() {
+    QMutexLocker locker(&this->mutex_);
+    return this->drone_;
+}
+
+DroneModelItem *DronePlanner::getDrone() {
+    QMutexLocker locker(&this->mutex_);
+    return this->drone_->model_;
+}
+
+bool DronePlanner::needsReplan() {
+    std::shared_ptr<SceneSnapshot const> scene = this->model_->getSnapshot();
+    // Do not compute new trajectories if executing
+    // sent trajectory
+    if (scene->is_live_reference_) {
+        return false;
+    }
+
+    QMutexLocker locker(&this->mutex_);
+    return this->run_loop_ && this->inputsChanged(*scene);
+}
+
+qint64 DronePlanner::msecsUntilReady(qreal max_rate) {
+    QMutexLocker locker(&this->mutex_);
+    if (max_rate <= 0 || !this->replan_timer_.isValid()) {
+        return 0;
+    }
+    qint64 min_interval = qCeil(1000.0 / max_rate);
+    return qMax(min_interval - this->replan_timer_.elapsed(), qint64(0));
+}
+
+bool DronePlanner::inputsChanged(SceneSnapshot const &scene) {
+    // clear current trajectory once if no final point selected
+    if (this->target_ == nullptr) {
+        return this->computed_target_ != nullptr ||
+                this->traj_graphic_->model_->getSize() != 0;
+    }
+
+    // other drones or targets may have changed
+    // but none of the inputs for this drone
+    return this->target_changed_ ||
+            this->target_ != this->computed_target_ ||
+            scene.revision_ != this->scene_revision_ ||
+            this->drone_->model_->getGeneration() != this->drone_generation_ ||
+            this->target_->getGeneration() != this->target_generation_;
+}
+
+void DronePlanner::computeTraj() {
+    // Read constraints, waypoints and params from one copy of the
+    // scene without locking model
+    std::shared_ptr<SceneSnapshot const> scene = this->model_->getSnapshot();
+
+    // Do not compute new trajectories if executing
+    // sent trajectory
+    if (scene->is_live_reference_) {
+        return;
+    }
+
+    // Record inputs used for this traj
+    PointModelItem *target = nullptr;
+    bool reset_inputs = false;
+    {
+        QMutexLocker locker(&this->mutex_);
+        // skip if stopped or inputs changed back since scheduled
+        if (!this->run_loop_ || !this->inputsChanged(*scene)) {
+            return;
+        }
+        this->replan_timer_.start();
+        target = this->target_;
+        reset_inputs = this->target_changed_;
+        this->target_changed_ = false;
+        this->computed_target_ = target;
+        this->scene_revision_ = scene->revision_;
+        this->drone_generation_ = this->drone_->model_->getGeneration();
+        if (target) {
+            this->target_generation_ = target->getGeneration();
+        }
+    }
+
+    // Do not compute trajectory if no final point selected
+    if (target == nullptr) {
+        // clear current trajectory
+        this->getTrajGraphic()->model_->setPoints(QVector<QPointF>());
+        autogen::packet::traj3dof empty_traj;
+        this->model_->setCurrTraj3dof(this->drone_->model_, empty_traj);
+        emit updateGraphics(this->getTrajGraphic(), this->getDroneGraphic());
+        return;
+    }
+
+    // Time each stage of replan
+    qint64 stage_nsecs[NUM_PLAN_STAGES] = { 0 };
+    QElapsedTimer stage_timer;
+    stage_timer.start();
+
+    // Validate inputs, taking drone state from a single telemetry packet
+    DroneTelemetry telemetry = this->drone_->model_->getTelemetry();
+    QVector3D initial_pos = telemetry.pos;
+    QVector3D initial_vel = telemetry.vel;
+    QVector3D initial_acc = telemetry.accel;
+
+    QPointF final_pos_2D = target->getPos();
+    QVector3D final_pos = QVector3D(final_pos_2D.x(), final_pos_2D.y(), 0);
+    QVector<QRegion> const &ellipse_regions = scene->ellipse_regions_;
+
+    // validate inputs
+    INPUT_CODE input_code = this->validateInputs(ellipse_regions,
+                                                 initial_pos, final_pos);
+    // set valid input and update message if changed
+    if (this->model_->setIsValidInput(input_code)) {
+        this->model_->updateEllipseColors();
+        emit updateEllipseColors();
+        emit updateMessage(this->drone_->model_);
+    }
+    // Dont compute if invalid input
+//    if (input_code != INPUT_CODE::VALID_INPUT) {
+//        return;
+//    }
+    stage_nsecs[VALIDATE_STAGE] = stage_timer.nsecsElapsed();
+    stage_timer.start();
+
+    // Parameters
+
+    // Update persistent params, only rebuilding changed constraints
+    TrajectoryProblem &P = this->params_;
+    scene->loadSkyeFlyParams(&P, &this->params_cache_);
+    scene->loadEllipseConstraints(&P, &this->params_cache_);
+    scene->loadPosConstraints(&P, &this->params_cache_);
+    scene->loadWaypointConstraints(&P);
+
+    // set boundary conditions
+    TrajectoryInputs inputs(initial_pos, initial_vel, initial_acc,
+                            final_pos);
+
+    // Switch solver if backend changed, previous solution
+    // cannot seed a different backend
+    if (scene->solver_backend_ != this->backend_) {
+        this->solver_.reset(
+                    TrajectorySolver::create(scene->solver_backend_));
+        this->backend_ = scene->solver_backend_;
+        reset_inputs = true;
+    }
+
+    // Seed solve with previous traj if drone is still following it,
+    // otherwise reset to initial guess
+    QVector3D xyz_drone_pos = guiXyzToXyz(initial_pos);
+    qreal time_shift = 0;
+    bool warm_start = !reset_inputs && scene->is_warm_start_ &&
+            this->findWarmStartShift(xyz_drone_pos, &time_shift);
+
+    // Initialize problem, then seed with rest of previous traj
+    // or reset inputs
+    this->solver_->setProblem(P, inputs);
+    if (warm_start) {
+        this->loadSeed(time_shift);
+        this->solver_->setInitialGuess(this->seed_);
+    } else {
+        this->solver_->resetInputs();
+    }
+
+    // Solve for free or fixed final time
+    stage_nsecs[PARAMS_STAGE] = stage_timer.nsecsElapsed();
+    stage_timer.start();
+    TrajectoryOutputs const &O =
+            this->solver_->solve(scene->is_free_final_time_);
+    stage_nsecs[SOLVE_STAGE] = stage_timer.nsecsElapsed();
+    stage_timer.start();
+
+    // Iterations in resulting trajectory, skip publishing if
+    // backend returned no traj or outputs of different lengths
+    quint32 size = O.r.size();
+    if (size == 0 || O.t.size() != O.r.size() ||
+            O.v.size() != O.r.size() || O.a.size() != O.r.size()) {
+        // nothing to seed next solve with
+        this->warm_traj_.resize(0);
+        this->warm_times_.resize(0);
+        return;
+    }
+    // GUI trajecotry points, buffer reused between computes
+    this->trajectory_.resize(size);
+    // Mikipilot trajectory to send to drone
+    autogen::packet::traj3dof drone_traj3dof_data;
+    drone_traj3dof_data.K = size;
+
+    // keep traj to seed next solve
+    this->warm_traj_.resize(size);
+    this->warm_times_.resize(size);
+
+    for (quint32 i = 0; i < size; i++) {
+        this->warm_traj_[i] = O.r.at(i);
+        this->warm_times_[i] = O.t.at(i);
+
+        // Add points to GUI trajectory
+        QVector3D gui_coords = xyzToGuiXyz(O.r.at(i));
+        this->trajectory_[i] = QPointF(gui_coords.x(), gui_coords.y());
+
+        // Add data to mikipilot trajectory
+        // drone_traj3dof_data.clock_angle(k) = 90.0/180.0*3.141592*P.dt*k;
+        drone_traj3dof_data.time(i) = O.t.at(i);
+
+        // XYZ to NED conversion
+        drone_traj3dof_data.pos_ned(0, i) =  O.r.at(i).y();
+        drone_traj3dof_data.pos_ned(1, i) =  O.r.at(i).x();
+        drone_traj3dof_data.pos_ned(2, i) = -O.r.at(i).z();
+
+        drone_traj3dof_data.vel_ned(0, i) =  O.v.at(i).y();
+        drone_traj3dof_data.vel_ned(1, i) =  O.v.at(i).x();
+        drone_traj3dof_data.vel_ned(2, i) = -O.v.at(i).z();
+
+        drone_traj3dof_data.accl_ned(0, i) =  O.a.at(i).y();
+        drone_traj3dof_data.accl_ned(1, i) =  O.a.at(i).x();
+        drone_traj3dof_data.accl_ned(2, i) = -O.a.at(i).z();
+    }
+    stage_nsecs[CONVERT_STAGE] = stage_timer.nsecsElapsed();
+    stage_timer.start();
+
+    // Do not display new trajectories if executing
+    // sent trajectory. Needed because sometimes compute
+    // overlaps with setting live reference mode
+    if (this->model_->getSnapshot()->is_live_reference_ ||
+            !this->getRunFlag()) return;
+
+    // set points on graphical display
+    this->getTrajGraphic()->model_->copyPoints(this->trajectory_);
+    this->model_->setCurrTraj3dof(this->drone_->model_,
+                                  drone_traj3dof_data);
+
+    bool is_feasible;
+    if (O.violation > FEASIBILITY_TOLERANCE) {
+        // infeasible traj, set feasibility code and traj color to red
+        this->model_->setIsValidTraj(FEASIBILITY_CODE::INFEASIBLE);
+        is_feasible = false;
+    } else {
+        // feasible traj, set feasibility code and traj color to nominal
+        this->model_->setIsValidTraj(FEASIBILITY_CODE::FEASIBLE);
+        is_feasible = true;
+    }
+    // keep traj for scrubbing back through replans
+    this->history_.record(this->trajectory_, is_feasible);
+
+    if (scene->is_free_final_time_) {
+        emit finalTime(this->drone_->model_, O.t.at(size - 1));
+    }
+    emit updateMessage(this->drone_->model_);
+
+    this->setFeasibilityColor(is_feasible);
+    stage_nsecs[PUBLISH_STAGE] = stage_timer.nsecsElapsed();
+
+    // signal stats display once this replan is recorded
+    this->recordReplan(stage_nsecs, is_feasible, O.iterations, warm_start);
+    emit updateStats(this->drone_->model_);
+}
+
+PlannerStats DronePlanner::getPlannerStats() {
+    QMutexLocker locker(&this->mutex_);
+    return this->planner_stats_;
+}
+
+bool DronePlanner::findWarmStartShift(QVector3D const &xyz_pos,
+                                      qreal *time_shift) {
+    // find closest point on previous traj to drone
+    qreal min_dist = WARM_START_TOLERANCE;
+    bool found = false;
+    for (int i = 1; i < this->warm_traj_.size(); i++) {
+        QVector3D start = this->warm_traj_.at(i - 1);
+        QVector3D segment = this->warm_traj_.at(i) - start;
+        qreal length_2 = segment.lengthSquared();
+        qreal u = 0;
+        if (length_2 > 0) {
+            u = QVector3D::dotProduct(xyz_pos - start, segment) / length_2;
+            u = qBound(0.0, u, 1.0);
+        }
+        qreal dist = (start + (u * segment) - xyz_pos).length();
+        if (dist <= min_dist) {
+            // time drone has progressed along previous traj
+            min_dist = dist;
+            found = true;
+            qreal t_start = this->warm_times_.at(i - 1);
+            *time_shift = t_start + u * (this->warm_times_.at(i) - t_start);
+        }
+    }
+    return found;
+}
+
+void DronePlanner::loadSeed(qreal time_shift) {
+    // drop points drone has passed, times relative to now
+    int size = this->warm_times_.size();
+    int first = 0;
+    while (first < size - 1 && this->warm_times_.at(first) < time_shift) {
+        first++;
+    }
+    this->seed_.t.resize(size - first);
+    this->seed_.r.resize(size - first);
+    for (int i = first; i < size; i++) {
+        this->seed_.t[i - first] = this->warm_times_.at(i) - time_shift;
+        this->seed_.r[i - first] = this->warm_traj_.at(i);
+    }
+}
+
+void DronePlanner::recordReplan(
+        qint64 const stage_nsecs[NUM_PLAN_STAGES],
+        bool is_feasible, quint32 iterations, bool warm_start) {
+    QMutexLocker locker(&this->mutex_);
+    this->planner_stats_.recordReplan(stage_nsecs, is_feasible, iterations,
+                                      warm_start);
+}
+
+void DronePlanner::setFeasibilityColor(bool is_feasible) {
+    // get graphics items
+    DroneGraphicsItem *drone = this->getDroneGraphic();
+    PathGraphicsItem *traj = this->getTrajGraphic();
+
+    // set feasiblility color
+    if (is_feasible) {
+        traj->setColor(YELLOW);
+        drone->setIsFeasible(true);
+    } else {
+        traj->setColor(RED);
+        drone->setIsFeasible(false);
+    }
+    emit updateGraphics(traj, drone);
+}
+
+INPUT_CODE DronePlanner::validateInputs(
+        QVector<QRegion> const &ellipse_regions,
+        QVector3D const &initial_pos,
+        QVector3D const &final_pos) {
+    // get truncated drone pos
+    QPoint trunc_intial_pos(initial_pos.x(), initial_pos.y());
+    // get truncated final pos
+    QPoint trunc_final_pos(final_pos.x(), final_pos.y());
+
+    // Note: Only can use QPoint. coords are still in pixels so QPoint instead
+    // of QPointF should be fine
+
+    for (int i = 0; i < ellipse_regions.size(); i++) {
+        QRegion const &region = ellipse_regions.at(i);
+
+        // check if contains drone
+        if (region.boundingRect().contains(trunc_intial_pos)) {
+            // check cheaply in rect, then in ellipse
+            if (region.contains(trunc_intial_pos)) {
+                return INPUT_CODE::DRONE_OVERLAP;
+            }
+        }
+
+        // check if contains final point
+        if (region.boundingRect().contains(trunc_final_pos)) {
+            // check cheaply in rect, then in ellipse
+            if (region.contains(trunc_final_pos)) {
+                return INPUT_CODE::FINAL_POS_OVERLAP;
+            }
+        }
+
+        // check if overlapping with any other ellipses
+        /* Temp remove for performance
+        for (int j = i+1; j < ellipse_regions.size(); j++) {
+            // First look at intersection of boundingRects (cheaper to do)
+            if (region.boundingRect().intersects(
+                        ellipse_regions.at(j).boundingRect())) {
+                // If bounding rect overlaps, then check fine intersection
+                if (region.intersects(ellipse_regions.at(j))) {
+                    return INPUT_CODE::OBS_OVERLAP;
+                }
+            }
+        }
+        */
+    }
+    return INPUT_CODE::VALID_INPUT;
+}
+
+}  // namespace optgui
@@ -0,0 +1,183 @@
+// TITLE:   Optimization_Interface/src/controls/planner_stats.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/planner_stats.h"
+
+#include <QtMath>
+
+#include <cmath>
+
+namespace optgui {
+
+// histogram bucket layout
+static qint64 const MIN_BUCKET_NSECS = 1000;
+static int const BUCKETS_PER_DOUBLING = 8;
+static int const NUM_BUCKETS = 26 * BUCKETS_PER_DOUBLING + 1;
+
+// window for replan rate
+static qint64 const RATE_WINDOW_MSECS = 1000;
+
+LatencyHistogram::LatencyHistogram() : buckets_(NUM_BUCKETS, 0) {
+    this->count_ = 0;
+}
+
+void LatencyHistogram::record(qint64 nsecs) {
+    // first bucket holds everything under a microsecond,
+    // last bucket holds everything over the range
+    int index = 0;
+    if (nsecs >= MIN_BUCKET_NSECS) {
+        qreal doublings = std::log2(qreal(nsecs) / MIN_BUCKET_NSECS);
+        index = 1 + qFloor(doublings * BUCKETS_PER_DOUBLING);
+        index = qMin(index, NUM_BUCKETS - 1);
+    }
+    this->buckets_[index]++;
+    this->count_++;
+}
+
+qint64 LatencyHistogram::percentile(qreal fraction) const {
+    if (this->count_ == 0) {
+        return 0;
+    }
+
+    // find bucket containing rank of fraction
+    quint64 rank = qCeil(qBound(0.0, fraction, 1.0) * this->count_);
+    rank = qMax(rank, quint64(1));
+    quint64 seen = 0;
+    int index = 0;
+    for (; index < NUM_BUCKETS - 1; index++) {
+        seen += this->buckets_.at(index);
+        if (seen >= rank) {
+            break;
+        }
+    }
+    return qRound64(MIN_BUCKET_NSECS *
+                    qPow(2.0, qreal(index) / BUCKETS_PER_DOUBLING));
+}
+
+quint64 LatencyHistogram::getCount() const {
+    return this->count_;
+}
+
+PlannerStats::PlannerStats() : total_(), warm_solve_(), cold_solve_(),
+    recent_msecs_() {
+    this->infeasible_ = 0;
+    this->iterations_ = 0;
+    this->iteration_replans_ = 0;
+    this->warm_iterations_ = 0;
+    this->warm_iteration_replans_ = 0;
+    this->clock_.start();
+}
+
+void PlannerStats::recordReplan(qint64 const stage_nsecs[NUM_PLAN_STAGES],
+                                bool is_feasible, quint32 iterations,
+                                bool warm_start) {
+    qint64 total_nsecs = 0;
+    for (int i = 0; i < NUM_PLAN_STAGES; i++) {
+        this->stages_[i].record(stage_nsecs[i]);
+        total_nsecs += stage_nsecs[i];
+    }
+    this->total_.record(total_nsecs);
+    if (warm_start) {
+        this->warm_solve_.record(stage_nsecs[SOLVE_STAGE]);
+    } else {
+        this->cold_solve_.record(stage_nsecs[SOLVE_STAGE]);
+    }
+
+    if (!is_feasible) {
+        this->infeasible_++;
+    }
+    if (iterations > 0) {
+        this->iterations_ += iterations;
+        this->iteration_replans_++;
+        if (warm_start) {
+            this->warm_iterations_ += iterations;
+            this->warm_iteration_replans_++;
+        }
+    }
+
+    // drop replans outside rate window
+    qint64 now = this->clock_.elapsed();
+    this->recent_msecs_.enqueue(now);
+    while (this->recent_msecs_.head() <= now - RATE_WINDOW_MSECS) {
+        this->recent_msecs_.dequeue();
+    }
+}
+
+LatencyHistogram const &PlannerStats::getStage(PLAN_STAGE stage) const {
+    return this->stages_[stage];
+}
+
+LatencyHistogram const &PlannerStats::getTotal() const {
+    return this->total_;
+}
+
+quint64 PlannerStats::getReplans() const {
+    return this->total_.getCount();
+}
+
+qreal PlannerStats::getReplanRate() const {
+    qint64 now = this->clock_.elapsed();
+    int count = 0;
+    for (qint64 msecs : this->recent_msecs_) {
+        if (msecs > now - RATE_WINDOW_MSECS) {
+            count++;
+        }
+    }
+    return count * 1000.0 / RATE_WINDOW_MSECS;
+}
+
+qreal PlannerStats::getInfeasibleRate() const {
+    quint64 replans = this->getReplans();
+    return replans ? qreal(this->infeasible_) / replans : 0;
+}
+
+qreal PlannerStats::getMeanIterations() const {
+    return this->iteration_replans_ ?
+            qreal(this->iterations_) / this->iteration_replans_ : 0;
+}
+
+LatencyHistogram const &PlannerStats::getWarmSolve() const {
+    return this->warm_solve_;
+}
+
+LatencyHistogram const &PlannerStats::getColdSolve() const {
+    return this->cold_solve_;
+}
+
+qreal PlannerStats::getIterationsSaved() const {
+    quint64 cold_replans =
+            this->iteration_replans_ - this->warm_iteration_replans_;
+    if (this->warm_iteration_replans_ == 0 || cold_replans == 0) {
+        return 0;
+    }
+    quint64 cold_iterations = this->iterations_ - this->warm_iterations_;
+    return qreal(cold_iterations) / cold_replans -
+            qreal(this->warm_iterations_) / this->warm_iteration_replans_;
+}
+
+QString PlannerStats::getStageName(PLAN_STAGE stage) {
+    switch (stage) {
+        case VALIDATE_STAGE: {
+            return "validate";
+        }
+        case PARAMS_STAGE: {
+            return "params";
+        }
+        case SOLVE_STAGE: {
+            return "solve";
+        }
+        case CONVERT_STAGE: {
+            return "convert";
+        }
+        case PUBLISH_STAGE: {
+            return "publish";
+        }
+        default: {
+            return "total";
+        }
+    }
+}
+
+}  // namespace optgui
@@ -0,0 +1,149 @@
+// TITLE:   Optimization_Interface/src/controls/replan_scheduler.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/replan_scheduler.h"
+
+#include <QRunnable>
+
+#include <climits>
+
+namespace optgui {
+
+// Compute one traj for a planner on a pool thread
+class ReplanJob : public QRunnable {
+ public:
+    ReplanJob(ReplanScheduler *scheduler, DronePlanner *planner) {
+        this->scheduler_ = scheduler;
+        this->planner_ = planner;
+    }
+
+    void run() override {
+        this->planner_->computeTraj();
+        this->scheduler_->finishJob(this->planner_);
+    }
+
+ private:
+    ReplanScheduler *scheduler_;
+    DronePlanner *planner_;
+};
+
+ReplanScheduler::ReplanScheduler(ConstraintModel *model) :
+    pool_(), mutex_(), job_finished_() {
+    this->model_ = model;
+    // one worker per core regardless of number of drones
+    this->pool_.setMaxThreadCount(QThread::idealThreadCount());
+    // start dispatching on construction
+    this->run_loop_ = true;
+}
+
+ReplanScheduler::~ReplanScheduler() {
+    this->stopScheduler();
+}
+
+void ReplanScheduler::addPlanner(DronePlanner *planner) {
+    {
+        QMutexLocker locker(&this->mutex_);
+        this->planners_.insert(planner);
+    }
+    // wake dispatcher to compute first traj
+    this->model_->notifyChange();
+}
+
+void ReplanScheduler::removePlanner(DronePlanner *planner) {
+    // queued job returns early once stopped
+    planner->stopCompute();
+
+    QMutexLocker locker(&this->mutex_);
+    this->planners_.remove(planner);
+    while (this->pending_.contains(planner)) {
+        this->job_finished_.wait(&this->mutex_);
+    }
+}
+
+void ReplanScheduler::stopScheduler() {
+    {
+        QMutexLocker locker(&this->mutex_);
+        this->run_loop_ = false;
+    }
+    // wake dispatcher if waiting for model changes
+    this->model_->notifyChange();
+    this->wait();
+    this->pool_.waitForDone();
+}
+
+bool ReplanScheduler::getRunFlag() {
+    QMutexLocker locker(&this->mutex_);
+    return this->run_loop_;
+}
+
+void ReplanScheduler::run() {
+    // dispatch until flagged to stop
+    while (this->getRunFlag()) {
+        // save revision before checking planners so changes made
+        // while dispatching trigger another pass
+        quint64 revision = this->model_->getRevision();
+        qint64 timeout = this->dispatch();
+
+        // sleep until inputs change or a rate limited planner is ready
+        if (this->getRunFlag()) {
+            this->model_->waitForChange(revision,
+                                        timeout < 0 ? ULONG_MAX : timeout);
+        }
+    }
+}
+
+qint64 ReplanScheduler::dispatch() {
+    std::shared_ptr<SceneSnapshot const> scene = this->model_->getSnapshot();
+    DroneModelItem *curr_drone = this->model_->getCurrDrone();
+    DroneModelItem *staged_drone = this->model_->getStagedDrone();
+
+    QMutexLocker locker(&this->mutex_);
+    qint64 timeout = -1;
+    for (DronePlanner *planner : this->planners_) {
+        // coalesce requests, running job checks inputs again
+        // when it finishes
+        if (this->pending_.contains(planner) || !planner->needsReplan()) {
+            continue;
+        }
+
+        // limit replan rate
+        qint64 remaining = planner->msecsUntilReady(scene->max_replan_rate_);
+        if (remaining > 0) {
+            if (timeout < 0 || remaining < timeout) {
+                timeout = remaining;
+            }
+            continue;
+        }
+
+        // current drone first, then staged drone, then others
+        int priority = 0;
+        DroneModelItem *drone = planner->getDrone();
+        if (drone == curr_drone) {
+            priority = 2;
+        } else if (drone == staged_drone) {
+            priority = 1;
+        }
+
+        this->pending_.insert(planner);
+        this->pool_.start(new ReplanJob(this, planner), priority);
+    }
+    return timeout;
+}
+
+void ReplanScheduler::finishJob(DronePlanner *planner) {
+    // check before releasing planner to removePlanner
+    bool replan = planner->needsReplan();
+    {
+        QMutexLocker locker(&this->mutex_);
+        this->pending_.remove(planner);
+        this->job_finished_.wakeAll();
+    }
+    // inputs changed while computing, wake dispatcher to resubmit
+    if (replan) {
+        this->model_->notifyChange();
+    }
+}
+
+}  // namespace optgui
@@ -8,6 +8,15 @@
 namespace optgui {
     qreal const GRID_SIZE = 100.0;
     qreal const INIT_CLEARANCE = 0.5;
+    qreal const WARM_START_TOLERANCE = 1.0;
+    qreal const FEASIBILITY_TOLERANCE = 0.25;
+    qint32 const SCALE_BAR_HEIGHT = 100;
+    qreal const INIT_MAX_FRAME_RATE = 60;
+    QString const BASEMAP_SUFFIX = ".basemap";
+    qreal const LOD_DETAIL_SCALE = 0.1;
+    qreal const LOD_PATH_TOLERANCE = 1.0;
+    qint32 const TRAJ_HISTORY_SIZE = 20;
+    quint16 const INIT_MUX_PORT = 7000;
 
     QColor const RED = QColor(0xF6, 0x40, 0x3D);
     QColor const ORANGE = QColor(0xFD, 0x85, 0x30);
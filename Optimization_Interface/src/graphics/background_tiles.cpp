@@ -0,0 +1,170 @@
+// TITLE:   Optimization_Interface/src/graphics/background_tiles.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/graphics/background_tiles.h"
+
+#include <QtMath>
+
+#include <utility>
+
+namespace optgui {
+
+// tile edge in image pixels
+static qint32 const TILE_SIZE = 256;
+// max KB of decoded basemap tiles kept
+static qint32 const BASEMAP_CACHE_KBYTES = 128 * 1024;
+
+BackgroundTiles::BackgroundTiles() : levels_(), bbox_(), basemap_(),
+    basemap_cache_(BASEMAP_CACHE_KBYTES) {
+}
+
+void BackgroundTiles::setImage(QImage const &image, QRectF const &bbox) {
+    this->levels_.clear();
+    this->basemap_.reset();
+    this->basemap_cache_.clear();
+    this->bbox_ = bbox;
+    if (image.isNull() || bbox.isEmpty()) {
+        return;
+    }
+
+    // halve image until it fits in one tile
+    QImage level_image = image;
+    while (true) {
+        Level level;
+        level.width = level_image.width();
+        level.height = level_image.height();
+        level.cols = (level.width + TILE_SIZE - 1) / TILE_SIZE;
+        level.rows = (level.height + TILE_SIZE - 1) / TILE_SIZE;
+        level.tiles.reserve(level.cols * level.rows);
+        for (qint32 row = 0; row < level.rows; row++) {
+            for (qint32 col = 0; col < level.cols; col++) {
+                // edge tiles are cut short at image border
+                qint32 x = col * TILE_SIZE;
+                qint32 y = row * TILE_SIZE;
+                level.tiles.append(QPixmap::fromImage(
+                        level_image.copy(x, y,
+                                         qMin(TILE_SIZE, level.width - x),
+                                         qMin(TILE_SIZE, level.height - y))));
+            }
+        }
+        this->levels_.append(level);
+
+        if (level.width <= TILE_SIZE && level.height <= TILE_SIZE) {
+            break;
+        }
+        level_image = level_image.scaled(qMax(level.width / 2, 1),
+                                         qMax(level.height / 2, 1),
+                                         Qt::IgnoreAspectRatio,
+                                         Qt::SmoothTransformation);
+    }
+}
+
+void BackgroundTiles::setBasemap(std::unique_ptr<BasemapFile> basemap,
+                                 QRectF const &bbox) {
+    this->levels_.clear();
+    this->basemap_cache_.clear();
+    this->basemap_ = std::move(basemap);
+    this->bbox_ = bbox;
+    if (!this->basemap_ || !this->basemap_->isOpen()) {
+        this->basemap_.reset();
+        return;
+    }
+
+    // only level sizes are read up front
+    qint32 tile_size = this->basemap_->getTileSize();
+    for (qint32 i = 0; i < this->basemap_->getNumLevels(); i++) {
+        Level level;
+        level.width = this->basemap_->getLevelSize(i).width();
+        level.height = this->basemap_->getLevelSize(i).height();
+        level.cols = (level.width + tile_size - 1) / tile_size;
+        level.rows = (level.height + tile_size - 1) / tile_size;
+        this->levels_.append(level);
+    }
+}
+
+QPixmap BackgroundTiles::getTile(qint32 level, qint32 col,
+                                 qint32 row) const {
+    if (!this->basemap_) {
+        Level const &stored = this->levels_.at(level);
+        return stored.tiles.at(row * stored.cols + col);
+    }
+
+    // decode tile on first use, cache drops least recently used
+    quint64 key = (quint64(level) << 48) | (quint64(row) << 24) | col;
+    QPixmap *cached = this->basemap_cache_.object(key);
+    if (cached) {
+        return *cached;
+    }
+    QImage image = this->basemap_->readTile(level, col, row);
+    if (image.isNull()) {
+        return QPixmap();
+    }
+    QPixmap tile = QPixmap::fromImage(image);
+    qint32 cost = qMax(image.bytesPerLine() * image.height() / 1024, 1);
+    this->basemap_cache_.insert(key, new QPixmap(tile), cost);
+    return tile;
+}
+
+bool BackgroundTiles::isEmpty() const {
+    return this->levels_.isEmpty();
+}
+
+qint32 BackgroundTiles::getLevel(qreal scale) const {
+    // width of image on screen in pixels
+    qreal screen_width = this->bbox_.width() * scale;
+
+    // smallest level still at least as wide as it is drawn
+    qint32 index = 0;
+    while (index + 1 < this->levels_.size() &&
+           this->levels_.at(index + 1).width >= screen_width) {
+        index++;
+    }
+    return index;
+}
+
+void BackgroundTiles::draw(QPainter *painter, QRectF const &exposed,
+                           qreal scale) const {
+    QRectF visible = exposed.intersected(this->bbox_);
+    if (this->levels_.isEmpty() || visible.isEmpty()) {
+        return;
+    }
+
+    qint32 level_index = this->getLevel(scale);
+    Level const &level = this->levels_.at(level_index);
+    qint32 tile_size = this->basemap_ ?
+            this->basemap_->getTileSize() : TILE_SIZE;
+
+    // scene size of one level pixel
+    qreal pixel_width = this->bbox_.width() / level.width;
+    qreal pixel_height = this->bbox_.height() / level.height;
+    qreal tile_width = tile_size * pixel_width;
+    qreal tile_height = tile_size * pixel_height;
+
+    // range of tiles intersecting exposed rect
+    qint32 first_col = qFloor((visible.left() - this->bbox_.left()) /
+                              tile_width);
+    qint32 last_col = qMin(qFloor((visible.right() - this->bbox_.left()) /
+                                  tile_width), level.cols - 1);
+    qint32 first_row = qFloor((visible.top() - this->bbox_.top()) /
+                              tile_height);
+    qint32 last_row = qMin(qFloor((visible.bottom() - this->bbox_.top()) /
+                                  tile_height), level.rows - 1);
+
+    for (qint32 row = qMax(first_row, 0); row <= last_row; row++) {
+        for (qint32 col = qMax(first_col, 0); col <= last_col; col++) {
+            QPixmap tile = this->getTile(level_index, col, row);
+            if (tile.isNull()) {
+                continue;
+            }
+            QRectF target(this->bbox_.left() + col * tile_width,
+                          this->bbox_.top() + row * tile_height,
+                          tile.width() * pixel_width,
+                          tile.height() * pixel_height);
+            painter->drawPixmap(target, tile, QRectF(tile.rect()));
+        }
+    }
+}
+
+}  // namespace optgui
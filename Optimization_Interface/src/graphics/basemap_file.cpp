@@ -0,0 +1,397 @@
+// TITLE:   Optimization_Interface/src/graphics/basemap_file.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/graphics/basemap_file.h"
+
+#include <QDataStream>
+#include <QByteArray>
+#include <QBuffer>
+#include <QImageReader>
+#include <QPainter>
+
+namespace optgui {
+
+// file identification
+static quint32 const BASEMAP_MAGIC = 0x4F47424D;  // "OGBM"
+static quint32 const BASEMAP_VERSION = 1;
+// tile edge in pixels for written files
+static qint32 const BASEMAP_TILE_SIZE = 256;
+// byte offset of index offset field in header
+static qint64 const INDEX_OFFSET_POS = 4 * 4 + 4 * 8;
+// bytes of index per level and per tile
+static quint64 const LEVEL_RECORD_SIZE = 4 * 4;
+static quint64 const TILE_RECORD_SIZE = 8 + 4;
+// limits of valid files, dimensions fit in qint32 and each
+// level halves, so no more levels than bits in a dimension
+static qint32 const BASEMAP_MAX_DIMENSION = 0x7FFFFFFF;
+static quint32 const BASEMAP_MAX_LEVELS = 32;
+
+// set stream byte order and precision used by basemap files
+static void configureStream(QDataStream *stream) {
+    stream->setByteOrder(QDataStream::LittleEndian);
+    stream->setFloatingPointPrecision(QDataStream::DoublePrecision);
+}
+
+BasemapFile::BasemapFile() : file_(), data_(nullptr), size_(0),
+    tile_size_(0), bottom_left_(), top_right_(), levels_() {
+}
+
+BasemapFile::~BasemapFile() {
+    this->close();
+}
+
+bool BasemapFile::open(QString const &filename) {
+    this->close();
+
+    this->file_.setFileName(filename);
+    if (!this->file_.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    this->size_ = this->file_.size();
+    this->data_ = this->file_.map(0, this->size_);
+    if (!this->data_) {
+        this->close();
+        return false;
+    }
+
+    // parse header and index in place without copying file
+    QByteArray raw = QByteArray::fromRawData(
+                reinterpret_cast<char const *>(this->data_), this->size_);
+    QDataStream in(raw);
+    configureStream(&in);
+
+    quint32 magic, version, tile_size, num_levels;
+    double bottom_left_x, bottom_left_y, top_right_x, top_right_y;
+    quint64 index_offset;
+    in >> magic >> version >> tile_size >> num_levels;
+    in >> bottom_left_x >> bottom_left_y >> top_right_x >> top_right_y;
+    in >> index_offset;
+    quint64 size = this->size_;
+    if (in.status() != QDataStream::Ok || magic != BASEMAP_MAGIC ||
+            version != BASEMAP_VERSION || tile_size == 0 ||
+            tile_size > quint32(BASEMAP_MAX_DIMENSION) ||
+            num_levels == 0 || num_levels > BASEMAP_MAX_LEVELS ||
+            index_offset >= size ||
+            num_levels * LEVEL_RECORD_SIZE > size - index_offset) {
+        this->close();
+        return false;
+    }
+    this->tile_size_ = tile_size;
+    this->bottom_left_ = QPointF(bottom_left_x, bottom_left_y);
+    this->top_right_ = QPointF(top_right_x, top_right_y);
+
+    // read tile locations for each level
+    in.device()->seek(index_offset);
+    for (quint32 i = 0; i < num_levels; i++) {
+        LevelIndex level;
+        quint32 width, height, cols, rows;
+        in >> width >> height >> cols >> rows;
+        if (in.status() != QDataStream::Ok || width == 0 || height == 0 ||
+                width > quint32(BASEMAP_MAX_DIMENSION) ||
+                height > quint32(BASEMAP_MAX_DIMENSION) ||
+                cols != (width + tile_size - 1) / tile_size ||
+                rows != (height + tile_size - 1) / tile_size) {
+            this->close();
+            return false;
+        }
+        // tile entries of level must fit in file before allocating them,
+        // 64 bit so corrupt counts cannot wrap
+        quint64 num_tiles = quint64(cols) * rows;
+        quint64 pos = in.device()->pos();
+        if (num_tiles > quint64(BASEMAP_MAX_DIMENSION) || pos > size ||
+                num_tiles > (size - pos) / TILE_RECORD_SIZE) {
+            this->close();
+            return false;
+        }
+        level.width = width;
+        level.height = height;
+        level.cols = cols;
+        level.rows = rows;
+        level.offsets.resize(num_tiles);
+        level.lengths.resize(num_tiles);
+        for (quint64 j = 0; j < num_tiles; j++) {
+            in >> level.offsets[j] >> level.lengths[j];
+            if (level.offsets.at(j) > size ||
+                    level.lengths.at(j) > size - level.offsets.at(j)) {
+                this->close();
+                return false;
+            }
+        }
+        if (in.status() != QDataStream::Ok) {
+            this->close();
+            return false;
+        }
+        this->levels_.append(level);
+    }
+
+    return !this->levels_.isEmpty();
+}
+
+void BasemapFile::close() {
+    if (this->data_) {
+        this->file_.unmap(this->data_);
+        this->data_ = nullptr;
+    }
+    this->file_.close();
+    this->size_ = 0;
+    this->levels_.clear();
+}
+
+bool BasemapFile::isOpen() const {
+    return this->data_ != nullptr && !this->levels_.isEmpty();
+}
+
+QPointF BasemapFile::getBottomLeft() const {
+    return this->bottom_left_;
+}
+
+QPointF BasemapFile::getTopRight() const {
+    return this->top_right_;
+}
+
+qint32 BasemapFile::getTileSize() const {
+    return this->tile_size_;
+}
+
+qint32 BasemapFile::getNumLevels() const {
+    return this->levels_.size();
+}
+
+QSize BasemapFile::getLevelSize(qint32 level) const {
+    if (level < 0 || level >= this->levels_.size()) {
+        return QSize();
+    }
+    return QSize(this->levels_.at(level).width,
+                 this->levels_.at(level).height);
+}
+
+QImage BasemapFile::readTile(qint32 level, qint32 col, qint32 row) const {
+    if (level < 0 || level >= this->levels_.size()) {
+        return QImage();
+    }
+    LevelIndex const &index = this->levels_.at(level);
+    if (col < 0 || col >= index.cols || row < 0 || row >= index.rows) {
+        return QImage();
+    }
+
+    // decode straight from mapped pages
+    qint32 i = row * index.cols + col;
+    return QImage::fromData(this->data_ + index.offsets.at(i),
+                            index.lengths.at(i));
+}
+
+bool BasemapFile::write(QImage const &image, QPointF const &bottom_left,
+                        QPointF const &top_right, QString const &filename,
+                        char const *format) {
+    if (image.isNull()) {
+        return false;
+    }
+
+    QFile file(filename);
+    if (!file.open(QIODevice::ReadWrite | QIODevice::Truncate) ||
+            !writeHeader(&file, bottom_left, top_right)) {
+        return false;
+    }
+
+    // level 0 cut from image
+    QVector<LevelIndex> levels;
+    LevelIndex level = makeLevel(image.width(), image.height());
+    for (qint32 row = 0; row < level.rows; row++) {
+        for (qint32 col = 0; col < level.cols; col++) {
+            qint32 x = col * BASEMAP_TILE_SIZE;
+            qint32 y = row * BASEMAP_TILE_SIZE;
+            QImage tile = image.copy(
+                        x, y,
+                        qMin(BASEMAP_TILE_SIZE, level.width - x),
+                        qMin(BASEMAP_TILE_SIZE, level.height - y));
+            if (!appendTile(&file, tile, format, &level)) {
+                return false;
+            }
+        }
+    }
+    levels.append(level);
+
+    return finishFile(&file, format, &levels);
+}
+
+bool BasemapFile::write(QString const &image_file,
+                        QPointF const &bottom_left,
+                        QPointF const &top_right, QString const &filename,
+                        char const *format) {
+    QImageReader reader(image_file);
+    QSize size = reader.size();
+    if (!size.isValid() || size.isEmpty() ||
+            !reader.supportsOption(QImageIOHandler::ClipRect)) {
+        // clipped reads would decode whole image for every tile,
+        // decode it once instead
+        return write(reader.read(), bottom_left, top_right,
+                     filename, format);
+    }
+
+    QFile file(filename);
+    if (!file.open(QIODevice::ReadWrite | QIODevice::Truncate) ||
+            !writeHeader(&file, bottom_left, top_right)) {
+        return false;
+    }
+
+    // level 0 decoded one tile at a time, reader
+    // cannot read again once it has read an image
+    QVector<LevelIndex> levels;
+    LevelIndex level = makeLevel(size.width(), size.height());
+    for (qint32 row = 0; row < level.rows; row++) {
+        for (qint32 col = 0; col < level.cols; col++) {
+            qint32 x = col * BASEMAP_TILE_SIZE;
+            qint32 y = row * BASEMAP_TILE_SIZE;
+            QImageReader tile_reader(image_file);
+            tile_reader.setClipRect(
+                        QRect(x, y,
+                              qMin(BASEMAP_TILE_SIZE, level.width - x),
+                              qMin(BASEMAP_TILE_SIZE, level.height - y)));
+            QImage tile = tile_reader.read();
+            if (tile.isNull() ||
+                    !appendTile(&file, tile, format, &level)) {
+                return false;
+            }
+        }
+    }
+    levels.append(level);
+
+    return finishFile(&file, format, &levels);
+}
+
+bool BasemapFile::writeHeader(QFile *file, QPointF const &bottom_left,
+                              QPointF const &top_right) {
+    QDataStream out(file);
+    configureStream(&out);
+
+    // level count and index offset filled in at end
+    out << BASEMAP_MAGIC << BASEMAP_VERSION << quint32(BASEMAP_TILE_SIZE);
+    out << quint32(0);
+    out << double(bottom_left.x()) << double(bottom_left.y());
+    out << double(top_right.x()) << double(top_right.y());
+    out << quint64(0);
+
+    return out.status() == QDataStream::Ok;
+}
+
+BasemapFile::LevelIndex BasemapFile::makeLevel(qint32 width,
+                                               qint32 height) {
+    LevelIndex level;
+    level.width = width;
+    level.height = height;
+    level.cols = (width + BASEMAP_TILE_SIZE - 1) / BASEMAP_TILE_SIZE;
+    level.rows = (height + BASEMAP_TILE_SIZE - 1) / BASEMAP_TILE_SIZE;
+    level.offsets.reserve(level.cols * level.rows);
+    level.lengths.reserve(level.cols * level.rows);
+    return level;
+}
+
+bool BasemapFile::appendTile(QFile *file, QImage const &tile,
+                             char const *format, LevelIndex *level) {
+    QByteArray bytes;
+    QBuffer buffer(&bytes);
+    buffer.open(QIODevice::WriteOnly);
+    if (!tile.save(&buffer, format)) {
+        return false;
+    }
+
+    // tiles of level before may have been read back since last write
+    if (!file->seek(file->size())) {
+        return false;
+    }
+    level->offsets.append(file->pos());
+    level->lengths.append(bytes.size());
+    return file->write(bytes) == bytes.size();
+}
+
+bool BasemapFile::finishFile(QFile *file, char const *format,
+                             QVector<LevelIndex> *levels) {
+    // halve last level until it fits in one tile, each tile
+    // built from the up to four tiles it covers in level before
+    while (levels->last().width > BASEMAP_TILE_SIZE ||
+           levels->last().height > BASEMAP_TILE_SIZE) {
+        LevelIndex const prev = levels->last();
+        LevelIndex level = makeLevel(qMax(prev.width / 2, 1),
+                                     qMax(prev.height / 2, 1));
+        for (qint32 row = 0; row < level.rows; row++) {
+            for (qint32 col = 0; col < level.cols; col++) {
+                // join covered tiles of level before, which fill
+                // joined image exactly
+                qint32 last_col = qMin(2 * col + 1, prev.cols - 1);
+                qint32 last_row = qMin(2 * row + 1, prev.rows - 1);
+                QImage joined;
+                QPainter painter;
+                for (qint32 j = 2 * row; j <= last_row; j++) {
+                    for (qint32 i = 2 * col; i <= last_col; i++) {
+                        qint32 index = j * prev.cols + i;
+                        if (!file->seek(prev.offsets.at(index))) {
+                            return false;
+                        }
+                        QImage child = QImage::fromData(
+                                    file->read(prev.lengths.at(index)));
+                        if (child.isNull()) {
+                            return false;
+                        }
+                        // keep tiles opaque unless source has alpha
+                        if (joined.isNull()) {
+                            joined = QImage(
+                                    qMin(2 * BASEMAP_TILE_SIZE, prev.width -
+                                         2 * col * BASEMAP_TILE_SIZE),
+                                    qMin(2 * BASEMAP_TILE_SIZE, prev.height -
+                                         2 * row * BASEMAP_TILE_SIZE),
+                                    child.hasAlphaChannel() ?
+                                        QImage::Format_ARGB32_Premultiplied :
+                                        QImage::Format_RGB32);
+                            joined.fill(Qt::transparent);
+                            painter.begin(&joined);
+                        }
+                        painter.drawImage(
+                                    (i - 2 * col) * BASEMAP_TILE_SIZE,
+                                    (j - 2 * row) * BASEMAP_TILE_SIZE,
+                                    child);
+                    }
+                }
+                painter.end();
+
+                qint32 x = col * BASEMAP_TILE_SIZE;
+                qint32 y = row * BASEMAP_TILE_SIZE;
+                QImage tile = joined.scaled(
+                            qMin(BASEMAP_TILE_SIZE, level.width - x),
+                            qMin(BASEMAP_TILE_SIZE, level.height - y),
+                            Qt::IgnoreAspectRatio,
+                            Qt::SmoothTransformation);
+                if (!appendTile(file, tile, format, &level)) {
+                    return false;
+                }
+            }
+        }
+        levels->append(level);
+    }
+
+    // index at end of file
+    if (!file->seek(file->size())) {
+        return false;
+    }
+    QDataStream out(file);
+    configureStream(&out);
+    quint64 index_offset = file->pos();
+    for (LevelIndex const &level : *levels) {
+        out << quint32(level.width) << quint32(level.height);
+        out << quint32(level.cols) << quint32(level.rows);
+        for (qint32 i = 0; i < level.offsets.size(); i++) {
+            out << level.offsets.at(i) << level.lengths.at(i);
+        }
+    }
+
+    // patch level count and index offset into header
+    file->seek(3 * 4);
+    out << quint32(levels->size());
+    file->seek(INDEX_OFFSET_POS);
+    out << index_offset;
+
+    return out.status() == QDataStream::Ok;
+}
+
+}  // namespace optgui
@@ -11,6 +11,8 @@
 
 #include <cmath>
 #include <limits>
+#include <memory>
+#include <utility>
 
 #include "include/globals.h"
 
@@ -42,13 +44,28 @@ Canvas::Canvas(QObject *parent, QString background_file)
             SLOT(bringSelectedToFront()));
 
     this->front_depth_ = 0;
+    this->partial_updates_ = false;
+    this->scaling_factor_ = 1;
+    this->history_age_ = 0;
+    this->path_staged_graphic_ = nullptr;
+    this->grid_segment_size_ = 0;
+    this->render_scheduler_ = new RenderScheduler(this);
+    connect(this->render_scheduler_, SIGNAL(syncGraphics()),
+            this, SLOT(syncGraphicsItems()), Qt::DirectConnection);
     this->setBackgroundImage(background_file);
 }
 
 Canvas::~Canvas() {
+    delete this->render_scheduler_;
 }
 
 void Canvas::setBackgroundImage(QString filename) {
+    // large maps are streamed from tiled basemap files on disk
+    if (filename.endsWith(BASEMAP_SUFFIX)) {
+        this->setBasemap(filename);
+        return;
+    }
+
     QStringList list = filename.split('_');
     if (list.length() != 6) {
         // qDebug() << "Image filename not formatted correctly";
@@ -67,7 +84,40 @@ void Canvas::setBackgroundImage(QString filename) {
         this->background_topright_y_ = list[5].toDouble();
     }
 
-    this->background_image_ = QImage(":/assets/" + filename + ".png");
+    // build tile pyramid once, full image is not kept
+    this->background_tiles_.setImage(
+                QImage(":/assets/" + filename + ".png"),
+                this->getBackgroundRect());
+}
+
+void Canvas::setBasemap(QString filename) {
+    std::unique_ptr<BasemapFile> basemap(new BasemapFile());
+    if (!basemap->open(filename)) {
+        // qDebug() << "Could not open basemap" << filename;
+        return;
+    }
+
+    // set background location from basemap header
+    this->background_bottomleft_x_ = basemap->getBottomLeft().x();
+    this->background_bottomleft_y_ = basemap->getBottomLeft().y();
+    this->background_topright_x_ = basemap->getTopRight().x();
+    this->background_topright_y_ = basemap->getTopRight().y();
+
+    this->background_tiles_.setBasemap(std::move(basemap),
+                                       this->getBackgroundRect());
+}
+
+QRectF Canvas::getBackgroundRect() {
+    // calculate position of background image
+    double width  = this->background_topright_y_
+            - this->background_bottomleft_y_;
+    double height = this->background_topright_x_
+            - this->background_bottomleft_x_;
+
+    return QRectF(this->background_bottomleft_y_*GRID_SIZE,
+                  -this->background_topright_x_*GRID_SIZE,
+                  width*GRID_SIZE,
+                  height*GRID_SIZE);
 }
 
 void Canvas::bringSelectedToFront() {
@@ -91,12 +141,107 @@ void Canvas::updateGraphicsItems(PathGraphicsItem *traj,
     // verify graphics exist
     if (this->path_graphics_.contains(traj) &&
         this->drone_graphics_.contains(drone)) {
-        // schedule re-draw
-        traj->update(traj->boundingRect());
-        drone->update(drone->boundingRect());
+        // schedule re-draw with new traj points on next frame
+        this->render_scheduler_->syncPath(traj);
+        this->render_scheduler_->updateItem(drone);
+    }
+}
+
+void Canvas::updateEllipseGraphics() {
+    // schedule re-draw of ellipses with new colors
+    for (EllipseGraphicsItem *graphic : this->ellipse_graphics_) {
+        this->render_scheduler_->updateItem(graphic);
+    }
+}
+
+void Canvas::syncGraphicsItems() {
+    // items skip models whose generation has not changed
+    for (DroneGraphicsItem *graphic : this->drone_graphics_) {
+        graphic->syncFromModel();
+    }
+    for (EllipseGraphicsItem *graphic : this->ellipse_graphics_) {
+        graphic->syncFromModel();
+    }
+    for (PolygonGraphicsItem *graphic : this->polygon_graphics_) {
+        graphic->syncFromModel();
+    }
+    for (PlaneGraphicsItem *graphic : this->plane_graphics_) {
+        graphic->syncFromModel();
+    }
+    for (PointGraphicsItem *graphic : this->final_points_) {
+        graphic->syncFromModel();
+    }
+    for (WaypointGraphicsItem *graphic : this->waypoint_graphics_) {
+        graphic->syncFromModel();
+    }
+    for (PathHistoryGraphicsItem *graphic : this->history_graphics_) {
+        graphic->syncFromModel();
+    }
+}
+
+void Canvas::setPartialUpdates(bool enabled) {
+    this->partial_updates_ = enabled;
+    if (enabled) {
+        // bsp tree lets repaints skip items outside dirty region
+        this->setItemIndexMethod(QGraphicsScene::BspTreeIndex);
+    } else {
+        this->setItemIndexMethod(QGraphicsScene::NoIndex);
+    }
+    this->update();
+}
+
+bool Canvas::getPartialUpdates() {
+    return this->partial_updates_;
+}
+
+void Canvas::setScalingFactor(qreal scaling_factor) {
+    this->scaling_factor_ = scaling_factor;
+
+    // items announce their new bounds so index stays valid
+    for (PathGraphicsItem *path : this->path_graphics_) {
+        path->setScalingFactor(scaling_factor);
+    }
+    if (this->path_staged_graphic_) {
+        this->path_staged_graphic_->setScalingFactor(scaling_factor);
+    }
+    for (PathHistoryGraphicsItem *history : this->history_graphics_) {
+        history->setScalingFactor(scaling_factor);
+    }
+    for (DroneGraphicsItem *drone : this->drone_graphics_) {
+        drone->setScalingFactor(scaling_factor);
+    }
+    for (EllipseGraphicsItem *ellipse : this->ellipse_graphics_) {
+        ellipse->setScalingFactor(scaling_factor);
+    }
+    for (PolygonGraphicsItem *polygon : this->polygon_graphics_) {
+        polygon->setScalingFactor(scaling_factor);
+    }
+    for (PlaneGraphicsItem *plane : this->plane_graphics_) {
+        plane->setScalingFactor(scaling_factor);
+    }
+    for (PointGraphicsItem *point : this->final_points_) {
+        point->setScalingFactor(scaling_factor);
+    }
+    for (WaypointGraphicsItem *waypoint : this->waypoint_graphics_) {
+        waypoint->setScalingFactor(scaling_factor);
+    }
+}
+
+qreal Canvas::getScalingFactor() const {
+    return this->scaling_factor_;
+}
+
+void Canvas::setHistoryAge(qint32 age) {
+    this->history_age_ = age;
+    for (PathHistoryGraphicsItem *history : this->history_graphics_) {
+        history->setAge(age);
     }
 }
 
+qint32 Canvas::getHistoryAge() const {
+    return this->history_age_;
+}
+
 void Canvas::bringToFront(QGraphicsItem *item) {
     if (item->type() == ELLIPSE_GRAPHIC ||
             item->type() == POLYGON_GRAPHIC ||
@@ -110,10 +255,13 @@ void Canvas::bringToFront(QGraphicsItem *item) {
 }
 
 void Canvas::drawForeground(QPainter *painter, const QRectF &rect) {
-    // Get scaling factor for zoom
-    qreal scale = 1;
+    // Get scaling factor for zoom and visible area,
+    // scale is drawn in corner of view not of exposed rect
+    qreal scale = this->scaling_factor_;
+    QRectF visible = rect;
     if (!this->views().isEmpty()) {
-        scale = this->views().first()->matrix().m11();
+        QGraphicsView *view = this->views().first();
+        visible = view->mapToScene(view->viewport()->rect()).boundingRect();
     }
 
     // get meters scale
@@ -141,18 +289,20 @@ void Canvas::drawForeground(QPainter *painter, const QRectF &rect) {
     painter->setFont(this->font_);
 
     // Draw scale
-    painter->drawLine(rect.left() + offset, rect.bottom() - offset,
-                      rect.left() + (offset + segment_size),
-                      rect.bottom() - offset);
+    painter->drawLine(visible.left() + offset, visible.bottom() - offset,
+                      visible.left() + (offset + segment_size),
+                      visible.bottom() - offset);
     // Draw notches on scale
     for (qint32 i = 0; i <= segment_size; i += segment_size / 2) {
-        painter->drawLine(rect.left() + offset + i, rect.bottom() - offset,
-                          rect.left() + offset + i,
-                          rect.bottom() - notch_offset);
+        painter->drawLine(visible.left() + offset + i,
+                          visible.bottom() - offset,
+                          visible.left() + offset + i,
+                          visible.bottom() - notch_offset);
     }
 
     // Draw label
-    painter->drawText(rect.left() + offset, rect.bottom() - text_offset,
+    painter->drawText(visible.left() + offset,
+                      visible.bottom() - text_offset,
                       QString::number(qreal(segment_size) / 100) + "m");
 }
 
@@ -166,15 +316,51 @@ qint64 Canvas::roundDownPast(qint64 n, qint64 m) {
     return ((n - m + 1) / m) * m;
 }
 
+void Canvas::updateGridLines(QRectF const &rect, qint64 segment_size) {
+    if (segment_size == this->grid_segment_size_ &&
+            this->grid_bounds_.contains(rect)) {
+        return;
+    }
+
+    // cover visible area padded by half its size on each side,
+    // so panning reuses lines and line count stays bounded
+    // by the view size instead of the scene size
+    QRectF cover = rect;
+    if (!this->views().isEmpty()) {
+        QGraphicsView *view = this->views().first();
+        cover = cover.united(view->mapToScene(
+                                 view->viewport()->rect()).boundingRect());
+    }
+    cover.adjust(-cover.width() / 2, -cover.height() / 2,
+                 cover.width() / 2, cover.height() / 2);
+
+    // Set boundries of grid
+    qint64 top_bound = roundDownPast(qRound64(cover.top()), segment_size);
+    qint64 bot_bound = roundUpPast(qRound64(cover.bottom()), segment_size);
+    qint64 left_bound = roundDownPast(qRound64(cover.left()), segment_size);
+    qint64 right_bound = roundUpPast(qRound64(cover.right()), segment_size);
+
+    this->grid_lines_.clear();
+    // vertical grid lines
+    for (qint64 i = left_bound; i <= right_bound; i += segment_size) {
+        this->grid_lines_.append(QLineF(i, top_bound, i, bot_bound));
+    }
+    // horizontal grid lines
+    for (qint64 i = top_bound; i <= bot_bound; i += segment_size) {
+        this->grid_lines_.append(QLineF(left_bound, i, right_bound, i));
+    }
+
+    this->grid_bounds_ = QRectF(QPointF(left_bound, top_bound),
+                                QPointF(right_bound, bot_bound));
+    this->grid_segment_size_ = segment_size;
+}
+
 void Canvas::drawBackground(QPainter *painter, const QRectF &rect) {
     // Fill background
     QGraphicsScene::drawBackground(painter, rect);
 
     // Get scaling factor
-    qreal scale = 1;
-    if (!this->views().isEmpty()) {
-        scale = this->views().first()->matrix().m11();
-    }
+    qreal scale = this->scaling_factor_;
 
     // Expand scene to fit exposed area
     // (dtsull16): Already done in View::expandView ?
@@ -198,47 +384,18 @@ void Canvas::drawBackground(QPainter *painter, const QRectF &rect) {
     qreal pen_width = 2 / scale;
     qreal font_size = 20 / scale;
 
-    // Set boundries of grid
-    qint64 top_bound = roundDownPast(qRound64(rect.top()), segment_size);
-    qint64 bot_bound = roundUpPast(qRound64(rect.bottom()), segment_size);
-    qint64 left_bound = roundDownPast(qRound64(rect.left()), segment_size);
-    qint64 right_bound = roundUpPast(qRound64(rect.right()), segment_size);
-
     // Set pen
     this->background_pen_.setWidthF(pen_width);
     this->font_.setPointSizeF(font_size);
     painter->setPen(this->background_pen_);
     painter->setFont(this->font_);
 
-    // calculate position of background image
-    double width  = this->background_topright_y_
-            - this->background_bottomleft_y_;
-    double height = this->background_topright_x_
-            - this->background_bottomleft_x_;
-
-    QRectF bbox(this->background_bottomleft_y_*GRID_SIZE,
-                -this->background_topright_x_*GRID_SIZE,
-                width*GRID_SIZE,
-                height*GRID_SIZE);
+    // draw visible background tiles
+    this->background_tiles_.draw(painter, rect, scale);
 
-    // draw background image
-    painter->drawImage(bbox, this->background_image_);
-
-    // Draw vertical grid lines
-    for (qint32 i = 0; i <= right_bound; i += segment_size) {
-        painter->drawLine(i, top_bound, i, bot_bound);
-    }
-    for (qint32 i = 0; i >= left_bound; i -= segment_size) {
-        painter->drawLine(i, top_bound, i , bot_bound);
-    }
-
-    // Draw horizontal grid lines
-    for (qint32 i = 0; i <= bot_bound; i += segment_size) {
-        painter->drawLine(left_bound, i , right_bound, i);
-    }
-    for (qint32 i = 0; i >= top_bound; i -= segment_size) {
-        painter->drawLine(left_bound, i, right_bound, i);
-    }
+    // Draw grid lines, painter clips lines outside exposed rect
+    this->updateGridLines(rect, segment_size);
+    painter->drawLines(this->grid_lines_);
 
     // Draw origin coordinate
     painter->drawText(1, -2, "0");
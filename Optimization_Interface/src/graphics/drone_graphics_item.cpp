@@ -6,7 +6,8 @@
 #include "include/graphics/drone_graphics_item.h"
 
 #include <QGraphicsScene>
-#include <QGraphicsView>
+
+#include "include/graphics/canvas.h"
 
 namespace optgui {
 
@@ -17,9 +18,9 @@ DroneGraphicsItem::DroneGraphicsItem(DroneModelItem *model,
     // Set model
     this->model_ = model;
 
-    // Set pen
+    // Set pens, widths scaled by zoom
     this->pen_ = QPen(Qt::black);
-    this->pen_.setWidth(1);
+    this->selected_pen_ = QPen(Qt::black);
 
     // Set brush
     this->brush_ = QBrush(YELLOW);
@@ -35,8 +36,12 @@ DroneGraphicsItem::DroneGraphicsItem(DroneModelItem *model,
     this->is_staged_drone_ = false;
     this->is_executed_drone_ = false;
     this->is_feasible_ = true;
+    this->scaling_factor_ = 1;
+    this->updateZoomStyle();
 
     // Set position
+    this->synced_generation_ = this->model_->getGeneration();
+    this->syncing_ = false;
     QVector3D pos_3D = this->model_->getPos();
     QPointF pos_2D = QPointF(pos_3D.x(), pos_3D.y());
     this->setPos(pos_2D);
@@ -54,19 +59,6 @@ void DroneGraphicsItem::paint(QPainter *painter,
     Q_UNUSED(option);
     Q_UNUSED(widget);
 
-    // Update pos
-    QVector3D pos_3D = this->model_->getPos();
-    QPointF pos_2D = QPointF(pos_3D.x(), pos_3D.y());
-    this->setPos(pos_2D);
-
-    // scale with view zoom level
-    qreal scaling_factor = this->getScalingFactor();
-    if (this->isSelected()) {
-        this->pen_.setWidthF(3.0 / scaling_factor);
-    } else {
-        this->pen_.setWidthF(1.0 / scaling_factor);
-    }
-
     // draw curr selected drone circle
     if (this->is_curr_drone_
             || this->is_staged_drone_
@@ -79,26 +71,28 @@ void DroneGraphicsItem::paint(QPainter *painter,
         } else if (!this->getIsFeasible()) {
             selection_pen = QPen(RED);
         }
-        selection_pen.setWidthF(3.0 / scaling_factor);
+        selection_pen.setWidthF(3.0 / this->scaling_factor_);
         painter->setPen(selection_pen);
         painter->drawEllipse(QPointF(),
-                             this->size_ / scaling_factor,
-                             this->size_ / scaling_factor);
+                             this->size_ / this->scaling_factor_,
+                             this->size_ / this->scaling_factor_);
     }
 
     // Draw drone
-    painter->setPen(this->pen_);
+    if (this->isSelected()) {
+        painter->setPen(this->selected_pen_);
+    } else {
+        painter->setPen(this->pen_);
+    }
     painter->setBrush(this->brush_);
 
-    painter->drawPath(this->shape());
+    painter->drawPath(this->shape_);
 
     // Label with port
     if (this->model_->port_ != 0) {
-        QPointF text_pos(this->mapFromScene(pos_2D));
-        QFont font = painter->font();
-        font.setPointSizeF(12.0 / scaling_factor);
-        painter->setFont(font);
-        qreal text_box_size = 50.0 / scaling_factor;
+        QPointF text_pos(this->mapFromScene(this->pos()));
+        painter->setFont(this->font_);
+        qreal text_box_size = 50.0 / this->scaling_factor_;
         painter->drawText(text_pos.x() - text_box_size,
                           text_pos.y() - text_box_size,
                           text_box_size * 2, text_box_size * 2,
@@ -112,22 +106,63 @@ int DroneGraphicsItem::type() const {
 }
 
 QPainterPath DroneGraphicsItem::shape() const {
+    // diamond built for current zoom
+    return this->shape_;
+}
+
+void DroneGraphicsItem::setScalingFactor(qreal scaling_factor) {
+    if (scaling_factor == this->scaling_factor_) {
+        return;
+    }
+    // diamond scales with zoom
+    this->prepareGeometryChange();
+    this->scaling_factor_ = scaling_factor;
+    this->updateZoomStyle();
+}
+
+void DroneGraphicsItem::updateZoomStyle() {
+    // keep pens, label and diamond same size on screen
+    this->pen_.setWidthF(1.0 / this->scaling_factor_);
+    this->selected_pen_.setWidthF(3.0 / this->scaling_factor_);
+    this->font_.setPointSizeF(12.0 / this->scaling_factor_);
+
     // create diamond shape to draw
-    QPainterPath path;
     QPolygonF poly;
-    qreal size = this->size_ / this->getScalingFactor();
+    qreal size = this->size_ / this->scaling_factor_;
     poly << QPointF(0, size);
     poly << QPointF(size, 0);
     poly << QPointF(0, -size);
     poly << QPointF(-size, 0);
     poly << QPointF(0, size);
-    path.addPolygon(poly);
-    return path;
+    this->shape_ = QPainterPath();
+    this->shape_.addPolygon(poly);
+}
+
+void DroneGraphicsItem::syncFromModel() {
+    // read generation before pos so a concurrent change
+    // is picked up by the next sync
+    quint64 generation = this->model_->getGeneration();
+    if (generation == this->synced_generation_) {
+        return;
+    }
+    this->synced_generation_ = generation;
+
+    QVector3D pos_3D = this->model_->getPos();
+    this->syncing_ = true;
+    this->setPos(QPointF(pos_3D.x(), pos_3D.y()));
+    this->syncing_ = false;
 }
 
 QVariant DroneGraphicsItem::itemChange(GraphicsItemChange change,
                                          const QVariant &value) {
-    if (change == ItemPositionChange && this->scene()) {
+    if (change == ItemSceneHasChanged) {
+        // match zoom of canvas added to
+        Canvas *canvas = qobject_cast<Canvas *>(this->scene());
+        if (canvas) {
+            this->setScalingFactor(canvas->getScalingFactor());
+        }
+    }
+    if (change == ItemPositionChange && this->scene() && !this->syncing_) {
         // value is the new position
         QPointF newPos = value.toPointF();
 
@@ -140,15 +175,6 @@ QVariant DroneGraphicsItem::itemChange(GraphicsItemChange change,
     return QGraphicsItem::itemChange(change, value);
 }
 
-qreal DroneGraphicsItem::getScalingFactor() const {
-    // get the zoom scaling factor from the view
-    qreal scaling_factor = 1;
-    if (this->scene() && !this->scene()->views().isEmpty()) {
-        scaling_factor = this->scene()->views().first()->matrix().m11();
-    }
-    return scaling_factor;
-}
-
 void DroneGraphicsItem::setIsFeasible(bool feasible) {
     QMutexLocker(&this->mutex_);
     this->is_feasible_ = feasible;
@@ -7,9 +7,9 @@
 
 #include <QGraphicsScene>
 #include <QtMath>
-#include <QGraphicsView>
 
 #include "include/globals.h"
+#include "include/graphics/canvas.h"
 
 namespace optgui {
 
@@ -24,12 +24,14 @@ EllipseGraphicsItem::EllipseGraphicsItem(EllipseModelItem *model,
     fill.setAlpha(200);
     this->brush_ = QBrush(fill);
 
-    // Set pen
+    // Set pens, widths scaled by zoom
     this->pen_ = QPen(Qt::black);
-    this->pen_.setWidth(3);
+    this->selected_pen_ = QPen(Qt::black);
 
     // Set clearance pen
     this->clearance_pen_ = QPen(fill, 3, Qt::DashLine);
+    this->scaling_factor_ = 1;
+    this->updateZoomStyle();
 
     // Set flags
     this->setFlags(QGraphicsItem::ItemIsMovable |
@@ -37,6 +39,8 @@ EllipseGraphicsItem::EllipseGraphicsItem(EllipseModelItem *model,
                    QGraphicsItem::ItemSendsGeometryChanges);
 
     // Set position
+    this->synced_generation_ = this->model_->getGeneration();
+    this->syncing_ = false;
     this->setPos(this->model_->getPos());
 
     // Set resize handles
@@ -49,6 +53,7 @@ EllipseGraphicsItem::EllipseGraphicsItem(EllipseModelItem *model,
     this->width_handle_->hide();
     this->height_handle_->hide();
     this->radius_handle_->hide();
+    this->updateHandles();
 
     // set granularity for collision detection
     // collision detection is iterative, value between
@@ -71,8 +76,8 @@ QRectF EllipseGraphicsItem::boundingRect() const {
     // Add exterior border if direction flipped
     if (this->model_->getDirection()) {
         // scale with view
-        height += ELLIPSE_BORDER / this->getScalingFactor();
-        width += ELLIPSE_BORDER / this->getScalingFactor();
+        height += ELLIPSE_BORDER / this->scaling_factor_;
+        width += ELLIPSE_BORDER / this->scaling_factor_;
     }
     // return area of ellipse, QGraphicsItems stores rotation
     return QRectF(-width, -height, width * 2, height * 2);
@@ -85,44 +90,28 @@ void EllipseGraphicsItem::paint(QPainter *painter,
     Q_UNUSED(option);
     Q_UNUSED(widget);
 
-    // set color to red if overlapping
-    this->setRed(this->model_->getIsOverlap());
-
-    qreal scaling_factor = this->getScalingFactor();
     qreal width = this->model_->getWidth();
     qreal height = this->model_->getHeight();
-    QPointF pos = this->model_->getPos();
-
-    // update graphics pos with model pos
-    this->setPos(pos);
 
-    // Show handles if selected
+    // Thicker outline if selected
     if (this->isSelected()) {
-        this->width_handle_->setPos(-width, 0);
-        this->height_handle_->setPos(0, -height);
-        this->radius_handle_->setPos(-width * qCos(qDegreesToRadians(45.0)),
-                                     -height * qSin(qDegreesToRadians(45.0)));
-
-        this->width_handle_->show();
-        this->height_handle_->show();
-        this->radius_handle_->show();
-
-        this->pen_.setWidthF(3.0 / scaling_factor);
+        painter->setPen(this->selected_pen_);
     } else {
-        this->width_handle_->hide();
-        this->height_handle_->hide();
-        this->radius_handle_->hide();
+        painter->setPen(this->pen_);
+    }
 
-        this->pen_.setWidthF(1.0 / scaling_factor);
+    // Zoomed far out, draw plain fill without clearance or label
+    if (this->scaling_factor_ < LOD_DETAIL_SCALE) {
+        painter->setBrush(this->brush_);
+        painter->drawEllipse(QRectF(-width, -height, width * 2, height * 2));
+        return;
     }
-    painter->setPen(this->pen_);
 
     // Draw shape
     painter->fillPath(this->shape(), this->brush_);
     painter->drawEllipse(QRectF(-width, -height, width * 2, height * 2));
 
     // Draw clearance boundry
-    this->clearance_pen_.setWidthF(3.0 / scaling_factor);
     qreal clearance_height =
             height + (this->model_->getClearance() * GRID_SIZE);
     qreal clearance_width =
@@ -135,11 +124,9 @@ void EllipseGraphicsItem::paint(QPainter *painter,
     if (this->model_->port_ != 0) {
         painter->rotate(-this->rotation());
         painter->setPen(Qt::black);
-        QPointF text_pos(this->mapFromScene(pos));
-        QFont font = painter->font();
-        font.setPointSizeF(12 / scaling_factor);
-        painter->setFont(font);
-        qreal text_box_size = 50.0 / scaling_factor;
+        QPointF text_pos(this->mapFromScene(this->pos()));
+        painter->setFont(this->font_);
+        qreal text_box_size = 50.0 / this->scaling_factor_;
         painter->drawText(text_pos.x() - text_box_size,
                           text_pos.y() - text_box_size,
                           text_box_size * 2, text_box_size * 2,
@@ -182,9 +169,74 @@ void EllipseGraphicsItem::flipDirection() {
     this->update(this->boundingRect());
 }
 
+void EllipseGraphicsItem::setScalingFactor(qreal scaling_factor) {
+    if (scaling_factor == this->scaling_factor_) {
+        return;
+    }
+    // flipped border scales with zoom
+    this->prepareGeometryChange();
+    this->scaling_factor_ = scaling_factor;
+    this->updateZoomStyle();
+
+    this->width_handle_->setScalingFactor(scaling_factor);
+    this->height_handle_->setScalingFactor(scaling_factor);
+    this->radius_handle_->setScalingFactor(scaling_factor);
+}
+
+void EllipseGraphicsItem::updateZoomStyle() {
+    // keep pens and label same size on screen
+    this->pen_.setWidthF(1.0 / this->scaling_factor_);
+    this->selected_pen_.setWidthF(3.0 / this->scaling_factor_);
+    this->clearance_pen_.setWidthF(3.0 / this->scaling_factor_);
+    this->font_.setPointSizeF(12 / this->scaling_factor_);
+}
+
+void EllipseGraphicsItem::syncFromModel() {
+    // overlap is set by planner without bumping generation
+    this->setRed(this->model_->getIsOverlap());
+
+    // read generation before model so a concurrent change
+    // is picked up by the next sync
+    quint64 generation = this->model_->getGeneration();
+    if (generation == this->synced_generation_) {
+        return;
+    }
+    this->synced_generation_ = generation;
+
+    // size and clearance change bounds
+    this->prepareGeometryChange();
+    this->syncing_ = true;
+    this->setPos(this->model_->getPos());
+    this->syncing_ = false;
+    this->updateHandles();
+}
+
+void EllipseGraphicsItem::updateHandles() {
+    qreal width = this->model_->getWidth();
+    qreal height = this->model_->getHeight();
+    this->width_handle_->setPos(-width, 0);
+    this->height_handle_->setPos(0, -height);
+    this->radius_handle_->setPos(-width * qCos(qDegreesToRadians(45.0)),
+                                 -height * qSin(qDegreesToRadians(45.0)));
+}
+
 QVariant EllipseGraphicsItem::itemChange(GraphicsItemChange change,
                                          const QVariant &value) {
-    if (change == ItemPositionChange && this->scene()) {
+    if (change == ItemSceneHasChanged) {
+        // match zoom of canvas added to
+        Canvas *canvas = qobject_cast<Canvas *>(this->scene());
+        if (canvas) {
+            this->setScalingFactor(canvas->getScalingFactor());
+        }
+    }
+    if (change == ItemSelectedHasChanged) {
+        // show handles while selected
+        bool selected = value.toBool();
+        this->width_handle_->setVisible(selected);
+        this->height_handle_->setVisible(selected);
+        this->radius_handle_->setVisible(selected);
+    }
+    if (change == ItemPositionChange && this->scene() && !this->syncing_) {
         // value is the new position
         QPointF newPos = value.toPointF();
 
@@ -197,13 +249,4 @@ QVariant EllipseGraphicsItem::itemChange(GraphicsItemChange change,
     return QGraphicsItem::itemChange(change, value);
 }
 
-qreal EllipseGraphicsItem::getScalingFactor() const {
-    // get zoom scaling factor from view
-    qreal scaling_factor = 1;
-    if (this->scene() && !this->scene()->views().isEmpty()) {
-        scaling_factor = this->scene()->views().first()->matrix().m11();
-    }
-    return scaling_factor;
-}
-
 }  // namespace optgui
@@ -8,9 +8,9 @@
 #include <QtMath>
 #include <QPen>
 #include <QGraphicsScene>
-#include <QGraphicsView>
 
 #include "include/globals.h"
+#include "include/graphics/ellipse_graphics_item.h"
 
 namespace optgui {
 
@@ -80,38 +80,24 @@ void EllipseResizeHandle::mouseMoveEvent(QGraphicsSceneMouseEvent *event) {
         this->model_->setRot(rotation);
         this->parentItem()->setRotation(rotation);
 
-        // re-render ellipse graphic
-        this->update(this->boundingRect());
+        // move other handles and re-render ellipse graphic
+        static_cast<EllipseGraphicsItem *>(
+                    this->parentItem())->syncFromModel();
     }
 }
 
-void EllipseResizeHandle::paint(QPainter *painter,
-                                const QStyleOptionGraphicsItem *option,
-                                QWidget *widget) {
-    // scale with view
-    qreal scaling_factor = this->getScalingFactor();
-    qreal size = this->size_ / scaling_factor;
-    QPen pen = this->pen();
-    pen.setWidthF(1.0 / scaling_factor);
-    this->setPen(pen);
-    this->setRect(-size, -size, size * 2, size * 2);
-
-    // paint
-    QGraphicsEllipseItem::paint(painter, option, widget);
-}
-
 int EllipseResizeHandle::type() const {
     // return unique graphic type
     return ELLIPSE_HANDLE_GRAPHIC;
 }
 
-qreal EllipseResizeHandle::getScalingFactor() const {
-    // get scaling zoom factor from view
-    qreal scaling_factor = 1;
-    if (this->scene() && !this->scene()->views().isEmpty()) {
-        scaling_factor = this->scene()->views().first()->matrix().m11();
-    }
-    return scaling_factor;
+void EllipseResizeHandle::setScalingFactor(qreal scaling_factor) {
+    // keep handle same size on screen
+    qreal size = this->size_ / scaling_factor;
+    QPen pen = this->pen();
+    pen.setWidthF(1.0 / scaling_factor);
+    this->setPen(pen);
+    this->setRect(-size, -size, size * 2, size * 2);
 }
 
 }  // namespace optgui
@@ -6,34 +6,99 @@
 #include "include/graphics/path_graphics_item.h"
 
 #include <QGraphicsScene>
-#include <QGraphicsView>
+
+#include "include/graphics/canvas.h"
 
 namespace optgui {
 
 PathGraphicsItem::PathGraphicsItem(PathModelItem *model,
                                    QGraphicsItem *parent,
                                    quint32 size)
-    : QGraphicsItem(parent) {
+    : QGraphicsItem(parent), mutex_(), polygon_(), path_(),
+      bounding_rect_(), decimated_() {
     // Set model
     this->model_ = model;
     this->width_ = size;
 
-    // Set pen
+    // Set pen, width scaled by zoom
     this->pen_ = QPen(RED);
     this->pen_.setWidth(this->width_);
+    this->scaling_factor_ = 1;
+
+    // Copy initial points
+    this->generation_ = this->model_->getGeneration();
+    this->loadPoints();
 
     // Set flags
     this->setFlags(QGraphicsItem::ItemSendsScenePositionChanges);
 }
 
 void PathGraphicsItem::setColor(QColor color) {
-    QMutexLocker(&this->mutex_);
+    QMutexLocker locker(&this->mutex_);
     this->pen_.setColor(color);
 }
 
+void PathGraphicsItem::setScalingFactor(qreal scaling_factor) {
+    if (scaling_factor == this->scaling_factor_) {
+        return;
+    }
+    this->scaling_factor_ = scaling_factor;
+    {
+        // keep line same width on screen
+        QMutexLocker locker(&this->mutex_);
+        this->pen_.setWidthF(this->width_ / scaling_factor);
+    }
+    this->decimatePoints();
+    this->update(this->boundingRect());
+}
+
+void PathGraphicsItem::syncFromModel() {
+    // read generation before points so a concurrent change
+    // is picked up by the next sync
+    quint64 generation = this->model_->getGeneration();
+    if (generation == this->generation_) {
+        return;
+    }
+    this->generation_ = generation;
+
+    this->prepareGeometryChange();
+    this->loadPoints();
+}
+
+void PathGraphicsItem::loadPoints() {
+    // copy points with one lock instead of one per point
+    this->polygon_ = QPolygonF(this->model_->getPoints());
+    this->path_ = QPainterPath();
+    this->path_.addPolygon(this->polygon_);
+    this->bounding_rect_ = this->polygon_.boundingRect();
+    this->decimatePoints();
+}
+
+void PathGraphicsItem::decimatePoints() {
+    // keep end points and points far enough from last kept point
+    // to be seen at current zoom
+    qreal tolerance = LOD_PATH_TOLERANCE / this->scaling_factor_;
+    qreal tolerance_sq = tolerance * tolerance;
+    int size = this->polygon_.size();
+
+    this->decimated_.clear();
+    this->decimated_.reserve(size);
+    for (int i = 0; i < size; i++) {
+        QPointF const &point = this->polygon_.at(i);
+        if (i == 0 || i == size - 1) {
+            this->decimated_.append(point);
+            continue;
+        }
+        QPointF diff = point - this->decimated_.last();
+        if (QPointF::dotProduct(diff, diff) >= tolerance_sq) {
+            this->decimated_.append(point);
+        }
+    }
+}
+
 QRectF PathGraphicsItem::boundingRect() const {
     // return rough area of traj line
-    return this->shape().boundingRect();
+    return this->bounding_rect_;
 }
 
 void PathGraphicsItem::paint(QPainter *painter,
@@ -43,32 +108,32 @@ void PathGraphicsItem::paint(QPainter *painter,
     Q_UNUSED(option);
     Q_UNUSED(widget);
 
-    // Draw current traj
-    qreal scaling_factor = this->getScalingFactor();
-    this->pen_.setWidthF(this->width_ / scaling_factor);
-    painter->setPen(this->pen_);
-    quint32 size = this->model_->getSize();
-    for (quint32 i = 1; i < size; i++) {
-        QLineF line(mapFromScene(this->model_->getPointAt(i - 1)),
-                    mapFromScene(this->model_->getPointAt(i)));
-        painter->drawLine(line);
+    // Get pen set by compute thread
+    QPen pen;
+    {
+        QMutexLocker locker(&this->mutex_);
+        pen = this->pen_;
     }
+
+    // Draw current traj
+    painter->setPen(pen);
+    painter->drawPolyline(this->decimated_);
 }
 
 QPainterPath PathGraphicsItem::shape() const {
     // return shape of traj line
-    QPainterPath path;
-    QPolygonF poly;
-    quint32 size = this->model_->getSize();
-    for (quint32 i = 0; i < size; i++) {
-        poly << this->model_->getPointAt(i);
-    }
-    path.addPolygon(poly);
-    return path;
+    return this->path_;
 }
 
 QVariant PathGraphicsItem::itemChange(GraphicsItemChange change,
                                         const QVariant &value) {
+    if (change == ItemSceneHasChanged) {
+        // match zoom of canvas added to
+        Canvas *canvas = qobject_cast<Canvas *>(this->scene());
+        if (canvas) {
+            this->setScalingFactor(canvas->getScalingFactor());
+        }
+    }
     if (change == ItemScenePositionHasChanged && scene()) {
         // check redraw
         this->update(this->boundingRect());
@@ -76,13 +141,4 @@ QVariant PathGraphicsItem::itemChange(GraphicsItemChange change,
     return QGraphicsItem::itemChange(change, value);
 }
 
-qreal PathGraphicsItem::getScalingFactor() const {
-    // get scaling zoom factor from view
-    qreal scaling_factor = 1;
-    if (this->scene() && !this->scene()->views().isEmpty()) {
-        scaling_factor = this->scene()->views().first()->matrix().m11();
-    }
-    return scaling_factor;
-}
-
 }  // namespace optgui
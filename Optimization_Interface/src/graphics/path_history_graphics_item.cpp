@@ -0,0 +1,156 @@
+// TITLE:   Optimization_Interface/src/graphics/path_history_graphics_item.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/graphics/path_history_graphics_item.h"
+
+#include <QGraphicsScene>
+
+#include "include/graphics/canvas.h"
+
+namespace optgui {
+
+// alpha of newest and oldest faded trajs
+static int const FADE_MAX_ALPHA = 160;
+static int const FADE_MIN_ALPHA = 20;
+
+PathHistoryGraphicsItem::PathHistoryGraphicsItem(
+        PathHistoryModelItem *model, QGraphicsItem *parent, quint32 size)
+    : QGraphicsItem(parent), polygons_(), timestamps_(), feasible_(),
+      bounding_rect_() {
+    // Set model
+    this->model_ = model;
+    this->width_ = size;
+
+    // Set pen, width scaled by zoom
+    this->pen_ = QPen(YELLOW);
+    this->pen_.setWidth(this->width_);
+    this->scaling_factor_ = 1;
+
+    // allocate copies for every slot of model
+    qint32 capacity = this->model_->getCapacity();
+    this->polygons_.resize(capacity);
+    this->timestamps_.resize(capacity);
+    this->feasible_.resize(capacity);
+    this->size_ = 0;
+
+    // hidden until scrubbed back
+    this->age_ = 0;
+    this->hide();
+
+    // Copy initial trajs, empty model is generation 0
+    this->generation_ = 0;
+    this->syncFromModel();
+}
+
+void PathHistoryGraphicsItem::setScalingFactor(qreal scaling_factor) {
+    if (scaling_factor == this->scaling_factor_) {
+        return;
+    }
+    // label scales with zoom
+    this->prepareGeometryChange();
+    this->scaling_factor_ = scaling_factor;
+    this->pen_.setWidthF(this->width_ / scaling_factor);
+    this->font_.setPointSizeF(12 / scaling_factor);
+}
+
+void PathHistoryGraphicsItem::setAge(qint32 age) {
+    this->age_ = age;
+    this->setVisible(age > 0);
+    this->update(this->boundingRect());
+}
+
+void PathHistoryGraphicsItem::syncFromModel() {
+    // read generation before trajs so a concurrent record
+    // is picked up by the next sync
+    quint64 generation = this->model_->getGeneration();
+    if (generation == this->generation_) {
+        return;
+    }
+    this->generation_ = generation;
+
+    this->prepareGeometryChange();
+    this->size_ = 0;
+    this->bounding_rect_ = QRectF();
+    for (qint32 age = 0; age < this->polygons_.size(); age++) {
+        bool is_feasible;
+        if (!this->model_->getEntry(age, &this->polygons_[age],
+                                    &this->timestamps_[age],
+                                    &is_feasible)) {
+            break;
+        }
+        this->feasible_[age] = is_feasible;
+        this->bounding_rect_ = this->bounding_rect_.united(
+                    this->polygons_.at(age).boundingRect());
+        this->size_++;
+    }
+}
+
+QRectF PathHistoryGraphicsItem::boundingRect() const {
+    // area of all trajs, padded for label at end of traj
+    qreal margin = 50.0 / this->scaling_factor_;
+    return this->bounding_rect_.adjusted(-margin, -margin,
+                                         margin, margin);
+}
+
+void PathHistoryGraphicsItem::paint(QPainter *painter,
+                                    const QStyleOptionGraphicsItem *option,
+                                    QWidget *widget) {
+    // suppress unused options errors
+    Q_UNUSED(option);
+    Q_UNUSED(widget);
+
+    // newest traj is drawn by traj graphic
+    QPen pen = this->pen_;
+    for (qint32 age = this->size_ - 1; age > 0; age--) {
+        if (age == this->age_) {
+            continue;
+        }
+        // fade older trajs
+        QColor color = this->feasible_.at(age) ? YELLOW : RED;
+        color.setAlpha(FADE_MAX_ALPHA - (FADE_MAX_ALPHA - FADE_MIN_ALPHA) *
+                       (age - 1) / qMax(this->size_ - 2, 1));
+        pen.setColor(color);
+        painter->setPen(pen);
+        painter->drawPolyline(this->polygons_.at(age));
+    }
+
+    // Draw scrubbed traj on top, labelled with time before newest
+    if (this->age_ <= 0 || this->age_ >= this->size_ ||
+            this->polygons_.at(this->age_).isEmpty()) {
+        return;
+    }
+    QPolygonF const &polygon = this->polygons_.at(this->age_);
+    pen.setColor(this->feasible_.at(this->age_) ? YELLOW : RED);
+    pen.setWidthF(this->pen_.widthF() * 1.5);
+    painter->setPen(pen);
+    painter->drawPolyline(polygon);
+
+    qreal secs = (this->timestamps_.at(0) -
+                  this->timestamps_.at(this->age_)) / 1000.0;
+    QPointF text_pos = polygon.last();
+    painter->setPen(BLACK);
+    painter->setFont(this->font_);
+    qreal text_box_size = 50.0 / this->scaling_factor_;
+    painter->drawText(text_pos.x() - text_box_size,
+                      text_pos.y() - text_box_size,
+                      text_box_size * 2, text_box_size * 2,
+                      Qt::AlignCenter,
+                      QString("-%1s").arg(secs, 0, 'f', 1));
+}
+
+QVariant PathHistoryGraphicsItem::itemChange(GraphicsItemChange change,
+                                             const QVariant &value) {
+    if (change == ItemSceneHasChanged) {
+        // match zoom and scrubbed age of canvas added to
+        Canvas *canvas = qobject_cast<Canvas *>(this->scene());
+        if (canvas) {
+            this->setScalingFactor(canvas->getScalingFactor());
+            this->setAge(canvas->getHistoryAge());
+        }
+    }
+    return QGraphicsItem::itemChange(change, value);
+}
+
+}  // namespace optgui
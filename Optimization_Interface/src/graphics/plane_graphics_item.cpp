@@ -6,10 +6,10 @@
 #include "include/graphics/plane_graphics_item.h"
 
 #include <QGraphicsScene>
-#include <QGraphicsView>
 #include <QLineF>
 
 #include "include/globals.h"
+#include "include/graphics/canvas.h"
 
 namespace optgui {
 
@@ -24,9 +24,13 @@ PlaneGraphicsItem::PlaneGraphicsItem(PlaneModelItem *model,
     fill.setAlpha(200);
     this->brush_ = QBrush(fill);
 
-    // Set brush
+    // Set brush, widths scaled by zoom
     this->pen_ = QPen(Qt::black);
-    this->pen_.setWidth(3);
+    this->selected_pen_ = QPen(Qt::black);
+    this->scaling_factor_ = 1;
+    this->shape_stale_ = true;
+    this->shape_generation_ = 0;
+    this->updateZoomStyle();
 
     // Set flags
     this->setFlags(QGraphicsItem::ItemIsMovable |
@@ -38,9 +42,11 @@ PlaneGraphicsItem::PlaneGraphicsItem(PlaneModelItem *model,
             new PlaneResizeHandle(this->model_, false, this);
     this->p2_handle_ =
             new PlaneResizeHandle(this->model_, true, this);
-    //
+    this->p1_handle_->updatePos();
+    this->p2_handle_->updatePos();
     this->p1_handle_->hide();
     this->p2_handle_->hide();
+    this->synced_generation_ = this->model_->getGeneration();
 }
 
 PlaneGraphicsItem::~PlaneGraphicsItem() {
@@ -60,39 +66,31 @@ void PlaneGraphicsItem::paint(QPainter *painter,
     Q_UNUSED(option);
     Q_UNUSED(widget);
 
-    // scale with view
-    qreal scaling_factor = this->getScalingFactor();
-
-    // Show handles if selected
+    // Thicker outline if selected
     if (this->isSelected()) {
-        this->p1_handle_->updatePos();
-        this->p2_handle_->updatePos();
-        this->p1_handle_->show();
-        this->p2_handle_->show();
-
-        this->pen_.setWidthF(3.0 / scaling_factor);
+        painter->setPen(this->selected_pen_);
     } else {
-        this->p1_handle_->hide();
-        this->p2_handle_->hide();
+        painter->setPen(this->pen_);
+    }
 
-        this->pen_.setWidthF(1.0 / scaling_factor);
+    // Zoomed far out, draw plane without shading or label
+    QLineF line(mapFromScene(this->model_->getP1()),
+                mapFromScene(this->model_->getP2()));
+    if (this->scaling_factor_ < LOD_DETAIL_SCALE) {
+        painter->drawLine(line);
+        return;
     }
 
     // Draw shape
-    painter->setPen(this->pen_);
     painter->setBrush(this->brush_);
     painter->fillPath(this->shape(), this->brush_);
-    QLineF line(mapFromScene(this->model_->getP1()),
-                mapFromScene(this->model_->getP2()));
     painter->drawLine(line);
 
     // Label with port
     if (this->model_->port_ != 0) {
         QPointF text_pos(this->mapFromScene(this->model_->getP1()));
-        QFont font = painter->font();
-        font.setPointSizeF(12 / scaling_factor);
-        painter->setFont(font);
-        qreal text_box_size = 50.0 / scaling_factor;
+        painter->setFont(this->font_);
+        qreal text_box_size = 50.0 / this->scaling_factor_;
         painter->drawText(text_pos.x() - text_box_size,
                           text_pos.y() - text_box_size,
                           text_box_size * 2, text_box_size * 2,
@@ -106,6 +104,40 @@ int PlaneGraphicsItem::type() const {
 }
 
 QPainterPath PlaneGraphicsItem::shape() const {
+    // rebuild border only after points, pos or zoom change
+    quint64 generation = this->model_->getGeneration();
+    if (this->shape_stale_ || generation != this->shape_generation_ ||
+            this->pos() != this->shape_pos_) {
+        this->shape_ = this->buildShape();
+        this->shape_generation_ = generation;
+        this->shape_pos_ = this->pos();
+        this->shape_stale_ = false;
+    }
+    return this->shape_;
+}
+
+void PlaneGraphicsItem::setScalingFactor(qreal scaling_factor) {
+    if (scaling_factor == this->scaling_factor_) {
+        return;
+    }
+    // border scales with zoom
+    this->prepareGeometryChange();
+    this->scaling_factor_ = scaling_factor;
+    this->shape_stale_ = true;
+    this->updateZoomStyle();
+
+    this->p1_handle_->setScalingFactor(scaling_factor);
+    this->p2_handle_->setScalingFactor(scaling_factor);
+}
+
+void PlaneGraphicsItem::updateZoomStyle() {
+    // keep pens and label same size on screen
+    this->pen_.setWidthF(1.0 / this->scaling_factor_);
+    this->selected_pen_.setWidthF(3.0 / this->scaling_factor_);
+    this->font_.setPointSizeF(12 / this->scaling_factor_);
+}
+
+QPainterPath PlaneGraphicsItem::buildShape() const {
     QPainterPath path;
 
     QLineF line(mapFromScene(this->model_->getP1()),
@@ -116,7 +148,7 @@ QPainterPath PlaneGraphicsItem::shape() const {
     }
 
     // scale border with view
-    qreal border = PLANE_BORDER / this->getScalingFactor();
+    qreal border = PLANE_BORDER / this->scaling_factor_;
 
     QPolygonF poly;
     poly << line.p1();
@@ -134,8 +166,35 @@ void PlaneGraphicsItem::flipDirection() {
     this->update(this->boundingRect());
 }
 
+void PlaneGraphicsItem::syncFromModel() {
+    // read generation before points so a concurrent change
+    // is picked up by the next sync
+    quint64 generation = this->model_->getGeneration();
+    if (generation == this->synced_generation_) {
+        return;
+    }
+    this->synced_generation_ = generation;
+
+    // moved points change border shape
+    this->prepareGeometryChange();
+    this->p1_handle_->updatePos();
+    this->p2_handle_->updatePos();
+}
+
 QVariant PlaneGraphicsItem::itemChange(GraphicsItemChange change,
                                        const QVariant &value) {
+    if (change == ItemSceneHasChanged) {
+        // match zoom of canvas added to
+        Canvas *canvas = qobject_cast<Canvas *>(this->scene());
+        if (canvas) {
+            this->setScalingFactor(canvas->getScalingFactor());
+        }
+    }
+    if (change == ItemSelectedHasChanged) {
+        // show handles while selected
+        this->p1_handle_->setVisible(value.toBool());
+        this->p2_handle_->setVisible(value.toBool());
+    }
     if (change == ItemPositionChange && scene()) {
         // value is the new position.
         QPointF newPos = value.toPointF();
@@ -151,12 +210,4 @@ QVariant PlaneGraphicsItem::itemChange(GraphicsItemChange change,
     return QGraphicsItem::itemChange(change, value);
 }
 
-qreal PlaneGraphicsItem::getScalingFactor() const {
-    qreal scaling_factor = 1;
-    if (this->scene() && !this->scene()->views().isEmpty()) {
-        scaling_factor = this->scene()->views().first()->matrix().m11();
-    }
-    return scaling_factor;
-}
-
 }  // namespace optgui
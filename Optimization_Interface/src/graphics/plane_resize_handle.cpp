@@ -8,9 +8,9 @@
 #include <QtMath>
 #include <QPen>
 #include <QGraphicsScene>
-#include <QGraphicsView>
 
 #include "include/globals.h"
+#include "include/graphics/plane_graphics_item.h"
 
 namespace optgui {
 
@@ -57,25 +57,6 @@ void PlaneResizeHandle::mousePressEvent(QGraphicsSceneMouseEvent *event) {
     }
 }
 
-void PlaneResizeHandle::paint(QPainter *painter,
-                                const QStyleOptionGraphicsItem *option,
-                                QWidget *widget) {
-    // suppress unused options errors
-    Q_UNUSED(option);
-    Q_UNUSED(widget);
-
-    // scale with view
-    qreal scaling_factor = this->getScalingFactor();
-    qreal size = this->size_ / scaling_factor;
-    QPen pen = this->pen();
-    pen.setWidthF(1.0 / scaling_factor);
-    this->setPen(pen);
-    this->setRect(-size, -size, size * 2, size * 2);
-
-    // paint
-    QGraphicsEllipseItem::paint(painter, option, widget);
-}
-
 void PlaneResizeHandle::mouseReleaseEvent(QGraphicsSceneMouseEvent *event) {
     if (event->button() == Qt::LeftButton) {
         this->resize_ = false;
@@ -90,7 +71,9 @@ void PlaneResizeHandle::mouseMoveEvent(QGraphicsSceneMouseEvent *event) {
         } else {
             this->model_->setP1(eventPos);
         }
-        this->update(this->boundingRect());
+        // move handle and re-render plane graphic
+        static_cast<PlaneGraphicsItem *>(
+                    this->parentItem())->syncFromModel();
     }
 }
 
@@ -106,12 +89,13 @@ QPointF PlaneResizeHandle::getPoint() {
     }
 }
 
-qreal PlaneResizeHandle::getScalingFactor() const {
-    qreal scaling_factor = 1;
-    if (this->scene() && !this->scene()->views().isEmpty()) {
-        scaling_factor = this->scene()->views().first()->matrix().m11();
-    }
-    return scaling_factor;
+void PlaneResizeHandle::setScalingFactor(qreal scaling_factor) {
+    // keep handle same size on screen
+    qreal size = this->size_ / scaling_factor;
+    QPen pen = this->pen();
+    pen.setWidthF(1.0 / scaling_factor);
+    this->setPen(pen);
+    this->setRect(-size, -size, size * 2, size * 2);
 }
 
 }  // namespace optgui
@@ -7,9 +7,9 @@
 
 #include <QGraphicsScene>
 #include <QtMath>
-#include <QGraphicsView>
 
 #include "include/globals.h"
+#include "include/graphics/canvas.h"
 
 namespace optgui {
 
@@ -25,9 +25,11 @@ PointGraphicsItem::PointGraphicsItem(PointModelItem *model,
     QColor fill = RED;
     this->brush_ = QBrush(fill);
 
-    // Set brush
+    // Set brush, widths scaled by zoom
     this->pen_ = QPen(Qt::black);
-    this->pen_.setWidth(3);
+    this->selected_pen_ = QPen(Qt::black);
+    this->scaling_factor_ = 1;
+    this->updateZoomStyle();
 
     // Set flags
     this->setFlags(QGraphicsItem::ItemIsMovable |
@@ -35,14 +37,14 @@ PointGraphicsItem::PointGraphicsItem(PointModelItem *model,
                    QGraphicsItem::ItemSendsGeometryChanges);
 
     // Set position
+    this->synced_generation_ = this->model_->getGeneration();
+    this->syncing_ = false;
     this->setPos(this->model_->getPos());
 }
 
 QRectF PointGraphicsItem::boundingRect() const {
     // return area of point scaled by zoom factor
-    qreal scaling_factor = this->getScalingFactor();
-    qreal rad = this->radius_ / scaling_factor;
-    return QRectF(-rad, -rad, rad * 2, rad * 2);
+    return this->bounding_rect_;
 }
 
 void PointGraphicsItem::paint(QPainter *painter,
@@ -52,33 +54,23 @@ void PointGraphicsItem::paint(QPainter *painter,
     Q_UNUSED(option);
     Q_UNUSED(widget);
 
-    // scale with view
-    qreal scaling_factor = this->getScalingFactor();
-
-    this->setPos(this->model_->getPos());
-
     // Show handles if selected
     if (this->isSelected()) {
-        this->pen_.setWidthF(3.0 / scaling_factor);
+        painter->setPen(this->selected_pen_);
     } else {
-        this->pen_.setWidthF(1.0 / scaling_factor);
+        painter->setPen(this->pen_);
     }
 
-    painter->setPen(this->pen_);
-
     // Draw shape
-    painter->fillPath(this->shape(), this->brush_);
-    qreal rad = this->radius_ / scaling_factor;
-    painter->drawEllipse(QRectF(-rad, -rad, rad * 2, rad * 2));
+    painter->fillPath(this->shape_, this->brush_);
+    painter->drawEllipse(this->bounding_rect_);
 
     // Label with port
     if (this->model_->port_ != 0) {
         painter->setPen(BLACK);
         QPointF text_pos(this->mapFromScene(this->model_->getPos()));
-        QFont font = painter->font();
-        font.setPointSizeF(10 / scaling_factor);
-        painter->setFont(font);
-        qreal text_box_size = 50.0 / scaling_factor;
+        painter->setFont(this->font_);
+        qreal text_box_size = 50.0 / this->scaling_factor_;
         painter->drawText(text_pos.x() - text_box_size,
                           text_pos.y() - text_box_size,
                           text_box_size * 2, text_box_size * 2,
@@ -94,14 +86,55 @@ int PointGraphicsItem::type() const {
 
 QPainterPath PointGraphicsItem::shape() const {
     // return shape of point
-    QPainterPath path;
-    path.addEllipse(this->boundingRect());
-    return path;
+    return this->shape_;
+}
+
+void PointGraphicsItem::setScalingFactor(qreal scaling_factor) {
+    if (scaling_factor == this->scaling_factor_) {
+        return;
+    }
+    // circle scales with zoom
+    this->prepareGeometryChange();
+    this->scaling_factor_ = scaling_factor;
+    this->updateZoomStyle();
+}
+
+void PointGraphicsItem::updateZoomStyle() {
+    // keep pens, label and circle same size on screen
+    this->pen_.setWidthF(1.0 / this->scaling_factor_);
+    this->selected_pen_.setWidthF(3.0 / this->scaling_factor_);
+    this->font_.setPointSizeF(10 / this->scaling_factor_);
+
+    qreal rad = this->radius_ / this->scaling_factor_;
+    this->bounding_rect_ = QRectF(-rad, -rad, rad * 2, rad * 2);
+    this->shape_ = QPainterPath();
+    this->shape_.addEllipse(this->bounding_rect_);
+}
+
+void PointGraphicsItem::syncFromModel() {
+    // read generation before pos so a concurrent change
+    // is picked up by the next sync
+    quint64 generation = this->model_->getGeneration();
+    if (generation == this->synced_generation_) {
+        return;
+    }
+    this->synced_generation_ = generation;
+
+    this->syncing_ = true;
+    this->setPos(this->model_->getPos());
+    this->syncing_ = false;
 }
 
 QVariant PointGraphicsItem::itemChange(GraphicsItemChange change,
                                        const QVariant &value) {
-    if (change == ItemPositionChange && scene()) {
+    if (change == ItemSceneHasChanged) {
+        // match zoom of canvas added to
+        Canvas *canvas = qobject_cast<Canvas *>(this->scene());
+        if (canvas) {
+            this->setScalingFactor(canvas->getScalingFactor());
+        }
+    }
+    if (change == ItemPositionChange && scene() && !this->syncing_) {
         // value is the new position.
         QPointF newPos = value.toPointF();
 
@@ -114,13 +147,4 @@ QVariant PointGraphicsItem::itemChange(GraphicsItemChange change,
     return QGraphicsItem::itemChange(change, value);
 }
 
-qreal PointGraphicsItem::getScalingFactor() const {
-    // get zoom scaling factor from view
-    qreal scaling_factor = 1;
-    if (this->scene() && !this->scene()->views().isEmpty()) {
-        scaling_factor = this->scene()->views().first()->matrix().m11();
-    }
-    return scaling_factor;
-}
-
 }  // namespace optgui
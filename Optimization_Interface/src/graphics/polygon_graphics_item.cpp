@@ -6,10 +6,10 @@
 #include "include/graphics/polygon_graphics_item.h"
 
 #include <QGraphicsScene>
-#include <QGraphicsView>
 #include <QLineF>
 
 #include "include/globals.h"
+#include "include/graphics/canvas.h"
 
 namespace optgui {
 
@@ -24,8 +24,13 @@ PolygonGraphicsItem::PolygonGraphicsItem(PolygonModelItem *model,
     fill.setAlpha(200);
     this->brush_ = QBrush(fill);
 
-    // Set brush
+    // Set brush, widths scaled by zoom
     this->pen_ = QPen(Qt::black);
+    this->selected_pen_ = QPen(Qt::black);
+    this->scaling_factor_ = 1;
+    this->shape_stale_ = true;
+    this->shape_generation_ = 0;
+    this->updateZoomStyle();
 
     // Set flags
     this->setFlags(QGraphicsItem::ItemIsMovable |
@@ -38,8 +43,10 @@ PolygonGraphicsItem::PolygonGraphicsItem(PolygonModelItem *model,
         PolygonResizeHandle *handle =
                 new PolygonResizeHandle(this->model_, i, this);
         this->resize_handles_.append(handle);
+        handle->updatePos();
         handle->hide();
     }
+    this->synced_generation_ = this->model_->getGeneration();
 }
 
 PolygonGraphicsItem::~PolygonGraphicsItem() {
@@ -50,8 +57,10 @@ PolygonGraphicsItem::~PolygonGraphicsItem() {
 }
 
 QRectF PolygonGraphicsItem::boundingRect() const {
-    // get rough area of polygon
-    return this->shape().boundingRect();
+    // get rough area of polygon, padded by outline width
+    qreal margin = this->selected_pen_.widthF();
+    return this->shape().boundingRect().adjusted(-margin, -margin,
+                                                 margin, margin);
 }
 
 void PolygonGraphicsItem::paint(QPainter *painter,
@@ -73,31 +82,20 @@ void PolygonGraphicsItem::paint(QPainter *painter,
     fill.setAlpha(200);
     this->brush_ = QBrush(fill);
 
-    // scale with view
-    qreal scaling_factor = 1;
-    if (this->scene() && !this->scene()->views().isEmpty()) {
-        scaling_factor = this->scene()->views().first()->matrix().m11();
-    }
-
-    // Show handles if selected
+    // Thicker outline if selected
     if (this->isSelected()) {
-        for (PolygonResizeHandle *handle : this->resize_handles_) {
-            handle->updatePos();
-            handle->show();
-        }
-
-        this->pen_.setWidthF(3.0 / scaling_factor);
+        painter->setPen(this->selected_pen_);
     } else {
-        for (PolygonResizeHandle *handle : this->resize_handles_) {
-            handle->hide();
-        }
-
-        this->pen_.setWidthF(1.0 / scaling_factor);
+        painter->setPen(this->pen_);
     }
 
-    painter->setPen(this->pen_);
     painter->setBrush(this->brush_);
 
+    // Zoomed far out, shape is plain polygon, fill it without label
+    if (this->scaling_factor_ < LOD_DETAIL_SCALE) {
+        painter->drawPath(this->shape());
+        return;
+    }
 
     // Fill shading
     painter->fillPath(this->shape(), this->brush_);
@@ -113,10 +111,8 @@ void PolygonGraphicsItem::paint(QPainter *painter,
     // Label with port
     if (this->model_->port_ != 0) {
         QPointF text_pos(this->mapFromScene(this->model_->getPointAt(0)));
-        QFont font = painter->font();
-        font.setPointSizeF(12 / scaling_factor);
-        painter->setFont(font);
-        qreal text_box_size = 50.0 / scaling_factor;
+        painter->setFont(this->font_);
+        qreal text_box_size = 50.0 / this->scaling_factor_;
         painter->drawText(text_pos.x() - text_box_size,
                           text_pos.y() - text_box_size,
                           text_box_size * 2, text_box_size * 2,
@@ -130,10 +126,57 @@ int PolygonGraphicsItem::type() const {
 }
 
 QPainterPath PolygonGraphicsItem::shape() const {
+    // rebuild border only after points, pos or zoom change
+    quint64 generation = this->model_->getGeneration();
+    if (this->shape_stale_ || generation != this->shape_generation_ ||
+            this->pos() != this->shape_pos_) {
+        this->shape_ = this->buildShape();
+        this->shape_generation_ = generation;
+        this->shape_pos_ = this->pos();
+        this->shape_stale_ = false;
+    }
+    return this->shape_;
+}
+
+void PolygonGraphicsItem::setScalingFactor(qreal scaling_factor) {
+    if (scaling_factor == this->scaling_factor_) {
+        return;
+    }
+    // border scales with zoom
+    this->prepareGeometryChange();
+    this->scaling_factor_ = scaling_factor;
+    this->shape_stale_ = true;
+    this->updateZoomStyle();
+
+    for (PolygonResizeHandle *handle : this->resize_handles_) {
+        handle->setScalingFactor(scaling_factor);
+    }
+}
+
+void PolygonGraphicsItem::updateZoomStyle() {
+    // keep pens and label same size on screen
+    this->pen_.setWidthF(1.0 / this->scaling_factor_);
+    this->selected_pen_.setWidthF(3.0 / this->scaling_factor_);
+    this->font_.setPointSizeF(12 / this->scaling_factor_);
+}
+
+QPainterPath PolygonGraphicsItem::buildShape() const {
     QPainterPath path;
 
+    // skip border shading when zoomed far out
+    if (this->scaling_factor_ < LOD_DETAIL_SCALE) {
+        QPolygonF poly;
+        quint32 size = this->model_->getSize();
+        for (quint32 i = 0; i < size; i++) {
+            poly << mapFromScene(this->model_->getPointAt(i));
+        }
+        path.addPolygon(poly);
+        path.closeSubpath();
+        return path;
+    }
+
     // scale border with view
-    qreal border = POLYGON_BORDER / this->getScalingFactor();
+    qreal border = POLYGON_BORDER / this->scaling_factor_;
 
     // Define exterior shadings
     quint32 size = this->model_->getSize();
@@ -164,8 +207,37 @@ void PolygonGraphicsItem::flipDirection() {
     this->update(this->boundingRect());
 }
 
+void PolygonGraphicsItem::syncFromModel() {
+    // read generation before points so a concurrent change
+    // is picked up by the next sync
+    quint64 generation = this->model_->getGeneration();
+    if (generation == this->synced_generation_) {
+        return;
+    }
+    this->synced_generation_ = generation;
+
+    // moved points change border shape
+    this->prepareGeometryChange();
+    for (PolygonResizeHandle *handle : this->resize_handles_) {
+        handle->updatePos();
+    }
+}
+
 QVariant PolygonGraphicsItem::itemChange(GraphicsItemChange change,
                                          const QVariant &value) {
+    if (change == ItemSceneHasChanged) {
+        // match zoom of canvas added to
+        Canvas *canvas = qobject_cast<Canvas *>(this->scene());
+        if (canvas) {
+            this->setScalingFactor(canvas->getScalingFactor());
+        }
+    }
+    if (change == ItemSelectedHasChanged) {
+        // show handles while selected
+        for (PolygonResizeHandle *handle : this->resize_handles_) {
+            handle->setVisible(value.toBool());
+        }
+    }
     if (change == ItemPositionChange && scene()) {
         // value is the new position.
         QPointF newPos = value.toPointF();
@@ -182,13 +254,4 @@ QVariant PolygonGraphicsItem::itemChange(GraphicsItemChange change,
     return QGraphicsItem::itemChange(change, value);
 }
 
-qreal PolygonGraphicsItem::getScalingFactor() const {
-    // get zoom scaling factor from view
-    qreal scaling_factor = 1;
-    if (this->scene() && !this->scene()->views().isEmpty()) {
-        scaling_factor = this->scene()->views().first()->matrix().m11();
-    }
-    return scaling_factor;
-}
-
 }  // namespace optgui
@@ -8,9 +8,9 @@
 #include <QtMath>
 #include <QPen>
 #include <QGraphicsScene>
-#include <QGraphicsView>
 
 #include "include/globals.h"
+#include "include/graphics/polygon_graphics_item.h"
 
 namespace optgui {
 
@@ -47,25 +47,6 @@ void PolygonResizeHandle::mousePressEvent(QGraphicsSceneMouseEvent *event) {
     }
 }
 
-void PolygonResizeHandle::paint(QPainter *painter,
-                                const QStyleOptionGraphicsItem *option,
-                                QWidget *widget) {
-    // suppress unused option errors
-    Q_UNUSED(option);
-    Q_UNUSED(widget);
-
-    // scale with view
-    qreal scaling_factor = this->getScalingFactor();
-    qreal size = this->size_ / scaling_factor;
-    QPen pen = this->pen();
-    pen.setWidthF(1.0 / scaling_factor);
-    this->setPen(pen);
-    this->setRect(-size, -size, size * 2, size * 2);
-
-    // paint ellipse
-    QGraphicsEllipseItem::paint(painter, option, widget);
-}
-
 void PolygonResizeHandle::mouseReleaseEvent(QGraphicsSceneMouseEvent *event) {
     if (event->button() == Qt::LeftButton) {
         this->resize_ = false;
@@ -74,10 +55,12 @@ void PolygonResizeHandle::mouseReleaseEvent(QGraphicsSceneMouseEvent *event) {
 
 void PolygonResizeHandle::mouseMoveEvent(QGraphicsSceneMouseEvent *event) {
     if (this->resize_) {
-        // update model with handle position and re-render
+        // update model with handle position
         QPointF eventPos = event->scenePos();
         this->model_->setPointAt(eventPos, this->index_);
-        this->update(this->boundingRect());
+        // move handle and re-render polygon graphic
+        static_cast<PolygonGraphicsItem *>(
+                    this->parentItem())->syncFromModel();
     }
 }
 
@@ -91,13 +74,13 @@ QPointF PolygonResizeHandle::getPoint() {
     return this->model_->getPointAt(this->index_);
 }
 
-qreal PolygonResizeHandle::getScalingFactor() const {
-    // get zoom scaling factor from view
-    qreal scaling_factor = 1;
-    if (this->scene() && !this->scene()->views().isEmpty()) {
-        scaling_factor = this->scene()->views().first()->matrix().m11();
-    }
-    return scaling_factor;
+void PolygonResizeHandle::setScalingFactor(qreal scaling_factor) {
+    // keep handle same size on screen
+    qreal size = this->size_ / scaling_factor;
+    QPen pen = this->pen();
+    pen.setWidthF(1.0 / scaling_factor);
+    this->setPen(pen);
+    this->setRect(-size, -size, size * 2, size * 2);
 }
 
 }  // namespace optgui
@@ -0,0 +1,152 @@
+// TITLE:   Optimization_Interface/src/graphics/render_scheduler.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/graphics/render_scheduler.h"
+
+#include <QtMath>
+
+#include "include/globals.h"
+
+namespace optgui {
+
+// window for frame rate
+static qint64 const RATE_WINDOW_MSECS = 1000;
+
+RenderScheduler::RenderScheduler(QObject *parent)
+    : QObject(parent), updates_(), paths_(),
+      frame_times_(), paint_times_(), recent_msecs_() {
+    this->timer_ = new QTimer(this);
+    this->timer_->setSingleShot(true);
+    this->timer_->setTimerType(Qt::PreciseTimer);
+    connect(this->timer_, SIGNAL(timeout()), this, SLOT(flush()));
+
+    this->max_frame_rate_ = INIT_MAX_FRAME_RATE;
+    this->requests_ = 0;
+    this->flushes_ = 0;
+    this->last_paint_nsecs_ = -1;
+    this->clock_.start();
+    this->last_flush_msecs_ = -RATE_WINDOW_MSECS;
+}
+
+RenderScheduler::~RenderScheduler() {
+    this->timer_->stop();
+    delete this->timer_;
+}
+
+void RenderScheduler::setMaxFrameRate(qreal rate) {
+    this->max_frame_rate_ = qMax(rate, 0.0);
+}
+
+qreal RenderScheduler::getMaxFrameRate() {
+    return this->max_frame_rate_;
+}
+
+void RenderScheduler::removeItem(QGraphicsItem *item) {
+    this->updates_.remove(item);
+    QSet<PathGraphicsItem *>::iterator iter = this->paths_.begin();
+    while (iter != this->paths_.end()) {
+        if (*iter == item) {
+            iter = this->paths_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+void RenderScheduler::updateItem(QGraphicsItem *item) {
+    this->updates_.insert(item);
+    this->scheduleFlush();
+}
+
+void RenderScheduler::syncPath(PathGraphicsItem *path) {
+    this->paths_.insert(path);
+    this->scheduleFlush();
+}
+
+void RenderScheduler::requestSync() {
+    this->scheduleFlush();
+}
+
+void RenderScheduler::scheduleFlush() {
+    this->requests_++;
+    if (this->timer_->isActive()) {
+        // already flushing on next frame
+        return;
+    }
+
+    // wait out rest of current frame
+    qint64 delay = 0;
+    if (this->max_frame_rate_ > 0) {
+        qint64 frame_msecs = qCeil(1000.0 / this->max_frame_rate_);
+        qint64 elapsed = this->clock_.elapsed() - this->last_flush_msecs_;
+        delay = qMax(frame_msecs - elapsed, qint64(0));
+    }
+    this->timer_->start(delay);
+}
+
+void RenderScheduler::flush() {
+    this->flushes_++;
+    this->last_flush_msecs_ = this->clock_.elapsed();
+
+    // sync stage, moving graphics marks old and new regions dirty
+    emit syncGraphics();
+    for (PathGraphicsItem *path : this->paths_) {
+        path->syncFromModel();
+        path->update(path->boundingRect());
+    }
+    for (QGraphicsItem *item : this->updates_) {
+        item->update(item->boundingRect());
+    }
+
+    this->paths_.clear();
+    this->updates_.clear();
+}
+
+void RenderScheduler::recordPaint(qint64 nsecs) {
+    this->paint_times_.record(nsecs);
+
+    // time since last painted frame
+    qint64 now = this->clock_.nsecsElapsed();
+    if (this->last_paint_nsecs_ >= 0) {
+        this->frame_times_.record(now - this->last_paint_nsecs_);
+    }
+    this->last_paint_nsecs_ = now;
+
+    // keep paint times in last second for frame rate
+    qint64 now_msecs = now / 1000000;
+    this->recent_msecs_.enqueue(now_msecs);
+    while (this->recent_msecs_.head() <= now_msecs - RATE_WINDOW_MSECS) {
+        this->recent_msecs_.dequeue();
+    }
+}
+
+LatencyHistogram const &RenderScheduler::getFrameTimes() const {
+    return this->frame_times_;
+}
+
+LatencyHistogram const &RenderScheduler::getPaintTimes() const {
+    return this->paint_times_;
+}
+
+qreal RenderScheduler::getFrameRate() const {
+    qint64 now = this->clock_.elapsed();
+    int count = 0;
+    for (qint64 msecs : this->recent_msecs_) {
+        if (msecs > now - RATE_WINDOW_MSECS) {
+            count++;
+        }
+    }
+    return count * 1000.0 / RATE_WINDOW_MSECS;
+}
+
+quint64 RenderScheduler::getRequests() const {
+    return this->requests_;
+}
+
+quint64 RenderScheduler::getFlushes() const {
+    return this->flushes_;
+}
+
+}  // namespace optgui
@@ -8,16 +8,29 @@
 #include <QHBoxLayout>
 #include <QScrollBar>
 #include <QInputDialog>
+#include <QFileDialog>
 #include <QSpinBox>
 #include <QDoubleSpinBox>
 #include <QPushButton>
 #include <QCheckBox>
+#include <QSlider>
 #include <QMessageBox>
+#include <QElapsedTimer>
+#include <QOpenGLWidget>
+#include <QOpenGLContext>
+#include <QSurfaceFormat>
+#include <QSignalBlocker>
 
-#include "include/controls/compute_thread.h"
+#include "include/controls/drone_planner.h"
 
 namespace optgui {
 
+// stats table rows after stage rows and total
+static int const WARM_SOLVE_ROW = NUM_PLAN_STAGES + 1;
+static int const COLD_SOLVE_ROW = NUM_PLAN_STAGES + 2;
+static int const SOLVE_SAVED_ROW = NUM_PLAN_STAGES + 3;
+static int const NUM_STATS_ROWS = NUM_PLAN_STAGES + 4;
+
 View::View(QWidget * parent)
     : QGraphicsView(parent) {
     // set background image
@@ -25,9 +38,22 @@ View::View(QWidget * parent)
             "demo-campus_outdoor_47.65355_-122.30755_120.0905_167.7810",
             "demo-field_outdoor_47.67158_-121.94751_304.6741_372.8843"};
 
+    QString const basemap_item = tr("Open basemap file...");
+    background_images.append(basemap_item);
+
     QString background_image = QInputDialog::getItem(this, tr("Select scene"),
                                       tr("mode"), background_images, 0, false);
 
+    // pick tiled basemap on disk, fall back to first scene if cancelled
+    if (background_image == basemap_item) {
+        background_image = QFileDialog::getOpenFileName(this,
+                tr("Open basemap"), QString(),
+                tr("Basemaps (*%1)").arg(BASEMAP_SUFFIX));
+        if (background_image.isEmpty()) {
+            background_image = background_images.first();
+        }
+    }
+
     // create new canvas to render
     this->canvas_ = new Canvas(this, background_image);
     this->setScene(this->canvas_);
@@ -77,6 +103,8 @@ View::View(QWidget * parent)
 
     this->initializeExpertPanel();
     this->initializeMenuPanel();
+    // stats also set message box tooltip, fill once both panels exist
+    this->updateStatsTable();
 
     // Expand view to fill screen
     this->expandView();
@@ -93,6 +121,7 @@ View::~View() {
     this->skyefly_params_table_->clear();
     delete this->skyefly_params_table_;
     delete this->model_params_table_;
+    delete this->stats_table_;
 
     // Delete layout components
     delete this->menu_button_;
@@ -200,7 +229,13 @@ void View::initializeExpertPanel() {
     this->initializeSkyeFlyParamsTable(this->expert_panel_);
     this->expert_panel_->menu_layout_->insertStretch(-1, 1);
     this->initializeDataCaptureToggle(this->expert_panel_);
+    this->initializeWarmStartToggle(this->expert_panel_);
+    this->initializeReferenceSolverToggle(this->expert_panel_);
+    this->initializePartialUpdatesToggle(this->expert_panel_);
+    this->initializeOpenGLViewportToggle(this->expert_panel_);
+    this->initializeHistoryScrubber(this->expert_panel_);
     this->initializeModelParamsTable(this->expert_panel_);
+    this->initializeStatsTable(this->expert_panel_);
 
     // Connect menu open/close
     connect(this->expert_menu_button_, SIGNAL(clicked()),
@@ -320,7 +355,7 @@ void View::mousePressEvent(QMouseEvent *event) {
         }
         case WAYPOINT: {
             if (this->controller_->getNumWaypoints()
-                    < skyenet::MAX_WAYPOINTS) {
+                    < MAX_WAYPOINTS) {
                 this->controller_->addWaypoint(pos);
             }
             break;
@@ -383,6 +418,8 @@ void View::openExpertMenu() {
 void View::setZoom(qreal value) {
     // set zoom scaling factor
     this->setTransform(QTransform::fromScale(value, value));
+    // items rescale pens and bounds to match
+    this->canvas_->setScalingFactor(value);
 }
 
 void View::setState(STATE button_type) {
@@ -446,6 +483,14 @@ void View::setClearance(qreal clearance) {
     this->controller_->setClearance(clearance);
 }
 
+void View::setMaxReplanRate(qreal rate) {
+    this->controller_->setMaxReplanRate(rate);
+}
+
+void View::setMaxFrameRate(qreal rate) {
+    this->canvas_->render_scheduler_->setMaxFrameRate(rate);
+}
+
 void View::setSkyeFlyParams() {
     // copy skyefly params from expert panel table to model
     this->controller_->setSkyeFlyParams(this->skyefly_params_table_);
@@ -467,6 +512,27 @@ void View::resizeEvent(QResizeEvent *event) {
     QGraphicsView::resizeEvent(event);
 }
 
+void View::scrollContentsBy(int dx, int dy) {
+    QGraphicsView::scrollContentsBy(dx, dy);
+
+    // scrolling copies drawn pixels, so meter scale drawn in bottom
+    // corner moves with them when only dirty regions are repainted
+    if (this->viewportUpdateMode() != QGraphicsView::FullViewportUpdate) {
+        QRect corner(0, this->viewport()->height() - SCALE_BAR_HEIGHT,
+                     this->viewport()->width(), SCALE_BAR_HEIGHT);
+        this->viewport()->update(
+                    QRegion(corner) + QRegion(corner.translated(dx, dy)));
+    }
+}
+
+void View::paintEvent(QPaintEvent *event) {
+    // time frame for render stats
+    QElapsedTimer timer;
+    timer.start();
+    QGraphicsView::paintEvent(event);
+    this->canvas_->render_scheduler_->recordPaint(timer.nsecsElapsed());
+}
+
 void View::expandView() {
     // Transpose view
     QRectF oldView = this->viewport()->rect();
@@ -806,14 +872,14 @@ void View::initializeSkyeFlyParamsTable(MenuPanel *panel) {
                                         Qt::AlignTop|Qt::AlignCenter);
 
     // Default skyefly param values
-    skyenet::params default_P;
+    TrajectoryProblem default_P;
     // TODO(dtsull16): get min and max values for all params
     quint32 row_index = 0;
 
     // P.K
     QSpinBox *params_K = new QSpinBox(this->skyefly_params_table_);
     // TODO(dtsull16): replace with skyenet::MIN_HORIZON
-    params_K->setRange(5, skyenet::MAX_HORIZON);
+    params_K->setRange(5, MAX_HORIZON);
     params_K->setValue(default_P.K);
     connect(params_K, SIGNAL(valueChanged(int)),
             this, SLOT(setSkyeFlyParams()));
@@ -1196,11 +1262,86 @@ void View::toggleDataCapture(int state) {
     this->controller_->setDataCapture(state == Qt::Checked);
 }
 
+void View::toggleWarmStart(int state) {
+    this->controller_->setWarmStart(state == Qt::Checked);
+}
+
+void View::toggleReferenceSolver(int state) {
+    if (state == Qt::Checked) {
+        this->controller_->setSolverBackend(REFERENCE_SOLVER);
+    } else {
+        this->controller_->setSolverBackend(SKYEFLY_SOLVER);
+    }
+}
+
+void View::togglePartialUpdates(int state) {
+    bool enabled = (state == Qt::Checked);
+    this->canvas_->setPartialUpdates(enabled);
+    if (enabled) {
+        this->setViewportUpdateMode(QGraphicsView::MinimalViewportUpdate);
+    } else {
+        this->setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
+    }
+    this->viewport()->update();
+}
+
+void View::toggleOpenGLViewport(int state) {
+    bool enabled = (state == Qt::Checked);
+    if (!this->setOpenGLViewport(enabled)) {
+        // stay on raster viewport, uncheck without re-toggling
+        QCheckBox *toggle = qobject_cast<QCheckBox *>(this->sender());
+        if (toggle) {
+            QSignalBlocker blocker(toggle);
+            toggle->setCheckState(Qt::Unchecked);
+        }
+        this->user_msg_label_->setText("OpenGL not available");
+    }
+}
+
+void View::setHistoryAge(int age) {
+    this->canvas_->setHistoryAge(age);
+    if (age == 0) {
+        this->history_label_->setText("Traj history: live");
+    } else {
+        this->history_label_->setText(
+                    QString("Traj history: %1 replans back").arg(age));
+    }
+}
+
+bool View::setOpenGLViewport(bool enabled) {
+    if (enabled) {
+        QSurfaceFormat format = QSurfaceFormat::defaultFormat();
+        format.setSamples(4);
+
+        // check context can be created before replacing viewport,
+        // software rasterizers such as llvmpipe also pass
+        QOpenGLContext context;
+        context.setFormat(format);
+        if (!context.create()) {
+            return false;
+        }
+
+        QOpenGLWidget *gl_viewport = new QOpenGLWidget();
+        gl_viewport->setFormat(format);
+        // keep framebuffer between frames so partial updates
+        // only redraw dirty regions
+        gl_viewport->setUpdateBehavior(QOpenGLWidget::PartialUpdate);
+        this->setViewport(gl_viewport);
+    } else {
+        this->setViewport(new QWidget());
+    }
+
+    // new viewport needs pinch zoom again
+    this->viewport()->grabGesture(Qt::PinchGesture);
+    this->viewport()->update();
+    return true;
+}
+
 void View::initializeModelParamsTable(MenuPanel *panel) {
     // Create table
     this->model_params_table_ = new QTableWidget(panel->menu_);
     this->model_params_table_->setColumnCount(1);  // fill with spinboxes
-    this->model_params_table_->setRowCount(1);  // how many params to edit
+    this->model_params_table_->setRowCount(3);  // how many params to edit
         // vertical headers are spinbox labels
     this->model_params_table_->verticalHeader()->setVisible(true);
     this->model_params_table_->verticalHeader()->
@@ -1213,7 +1354,7 @@ void View::initializeModelParamsTable(MenuPanel *panel) {
     this->model_params_table_->
             setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
         // set size
-    this->model_params_table_->setMaximumHeight(30);
+    this->model_params_table_->setMaximumHeight(90);
         // add table to menu panel
     panel->menu_->layout()->addWidget(this->model_params_table_);
     panel->menu_->layout()->setAlignment(this->model_params_table_,
@@ -1233,6 +1374,198 @@ void View::initializeModelParamsTable(MenuPanel *panel) {
     this->model_params_table_->
             setVerticalHeaderItem(row_index, new QTableWidgetItem("clearance"));
     row_index++;
+
+    // max replans per second, 0 for unlimited
+    QDoubleSpinBox *replan_rate =
+            new QDoubleSpinBox(this->model_params_table_);
+    replan_rate->setRange(0, 1000);
+    replan_rate->setSingleStep(1);
+    replan_rate->setValue(0);
+    replan_rate->setToolTip(tr("Max replans per second, 0 for unlimited"));
+    connect(replan_rate, SIGNAL(valueChanged(double)),
+            this, SLOT(setMaxReplanRate(double)));
+
+    this->model_params_table_->setCellWidget(row_index, 0, replan_rate);
+    this->model_params_table_->
+            setVerticalHeaderItem(row_index, new QTableWidgetItem("replan_hz"));
+    row_index++;
+
+    // max render frames per second, 0 for unlimited
+    QDoubleSpinBox *frame_rate =
+            new QDoubleSpinBox(this->model_params_table_);
+    frame_rate->setRange(0, 1000);
+    frame_rate->setSingleStep(1);
+    frame_rate->setValue(INIT_MAX_FRAME_RATE);
+    frame_rate->setToolTip(tr("Max render frames per second, "
+                              "0 for unlimited"));
+    connect(frame_rate, SIGNAL(valueChanged(double)),
+            this, SLOT(setMaxFrameRate(double)));
+
+    this->model_params_table_->setCellWidget(row_index, 0, frame_rate);
+    this->model_params_table_->
+            setVerticalHeaderItem(row_index, new QTableWidgetItem("frame_hz"));
+    row_index++;
+}
+
+void View::initializeStatsTable(MenuPanel *panel) {
+    // Create table of stage latency percentiles
+    this->stats_table_ = new QTableWidget(panel->menu_);
+    this->stats_table_->setColumnCount(3);
+    this->stats_table_->setRowCount(NUM_STATS_ROWS);
+    this->stats_table_->setHorizontalHeaderLabels(
+                QStringList() << "p50 ms" << "p95 ms" << "p99 ms");
+    this->stats_table_->horizontalHeader()->
+            setSectionResizeMode(QHeaderView::Stretch);
+    this->stats_table_->verticalHeader()->
+            setSectionResizeMode(QHeaderView::Stretch);
+    this->stats_table_->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    this->stats_table_->setSizePolicy(QSizePolicy::Expanding,
+                                      QSizePolicy::Fixed);
+    this->stats_table_->
+            setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    this->stats_table_->
+            setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    this->stats_table_->setMaximumHeight(260);
+    for (int i = 0; i < NUM_STATS_ROWS; i++) {
+        QString name = PlannerStats::getStageName(PLAN_STAGE(i));
+        if (i == WARM_SOLVE_ROW) {
+            name = "warm solve";
+        } else if (i == COLD_SOLVE_ROW) {
+            name = "cold solve";
+        } else if (i == SOLVE_SAVED_ROW) {
+            name = "warm saved";
+        }
+        this->stats_table_->setVerticalHeaderItem(i,
+                new QTableWidgetItem(name));
+        for (int j = 0; j < 3; j++) {
+            this->stats_table_->setItem(i, j, new QTableWidgetItem("-"));
+        }
+    }
+    panel->menu_->layout()->addWidget(this->stats_table_);
+    panel->menu_->layout()->setAlignment(this->stats_table_,
+                                        Qt::AlignBottom|Qt::AlignCenter);
+
+    // replan rate, iterations and infeasible rate
+    this->stats_label_ = new QLabel(panel->menu_);
+    this->stats_label_->setWordWrap(true);
+    panel->menu_->layout()->addWidget(this->stats_label_);
+    panel->menu_->layout()->setAlignment(this->stats_label_,
+                                        Qt::AlignBottom);
+    this->panel_widgets_.append(this->stats_label_);
+
+    QPushButton *dump_button = new QPushButton("Dump Stats", panel->menu_);
+    dump_button->setToolTip(tr("Save stage latencies for all drones to csv"));
+    panel->menu_->layout()->addWidget(dump_button);
+    panel->menu_->layout()->setAlignment(dump_button, Qt::AlignBottom);
+    this->panel_widgets_.append(dump_button);
+
+    connect(dump_button, SIGNAL(clicked()),
+            this, SLOT(dumpPlannerStats()));
+    // refresh once each replan of current drone is recorded
+    connect(this->controller_, SIGNAL(updateStats()),
+            this, SLOT(updateStatsTable()));
+}
+
+void View::updateStatsTable() {
+    PlannerStats stats = this->controller_->getCurrPlannerStats();
+
+    // percentiles in msecs for each stage, total, then solve
+    // stage of warm and cold starts
+    qreal const fractions[3] = { 0.50, 0.95, 0.99 };
+    for (int i = 0; i < SOLVE_SAVED_ROW; i++) {
+        LatencyHistogram const &histogram =
+                (i == WARM_SOLVE_ROW) ? stats.getWarmSolve() :
+                (i == COLD_SOLVE_ROW) ? stats.getColdSolve() :
+                (i == NUM_PLAN_STAGES) ? stats.getTotal() :
+                stats.getStage(PLAN_STAGE(i));
+        for (int j = 0; j < 3; j++) {
+            QString text = "-";
+            if (histogram.getCount() > 0) {
+                text = QString::number(
+                            histogram.percentile(fractions[j]) / 1e6,
+                            'f', 2);
+            }
+            this->stats_table_->item(i, j)->setText(text);
+        }
+    }
+
+    // solve time warm starts save over cold starts
+    LatencyHistogram const &warm = stats.getWarmSolve();
+    LatencyHistogram const &cold = stats.getColdSolve();
+    this->user_msg_label_->setToolTip(
+            QString("Warm starts: %1, p50 %2 ms\nCold starts: %3, p50 %4 ms")
+            .arg(warm.getCount())
+            .arg(warm.percentile(0.50) / 1e6, 0, 'f', 2)
+            .arg(cold.getCount())
+            .arg(cold.percentile(0.50) / 1e6, 0, 'f', 2));
+    for (int j = 0; j < 3; j++) {
+        QString text = "-";
+        if (warm.getCount() > 0 && cold.getCount() > 0) {
+            text = QString::number(
+                        (cold.percentile(fractions[j]) -
+                         warm.percentile(fractions[j])) / 1e6, 'f', 2);
+        }
+        this->stats_table_->item(SOLVE_SAVED_ROW, j)->setText(text);
+    }
+
+    // skyefly does not report iterations, leave them out
+    // instead of showing a saving of 0
+    QString iterations = "";
+    if (stats.getMeanIterations() > 0) {
+        QString iterations_saved = "-";
+        if (stats.getWarmSolve().getCount() > 0 &&
+                stats.getColdSolve().getCount() > 0) {
+            iterations_saved = QString::number(stats.getIterationsSaved(),
+                                               'f', 1);
+        }
+        iterations = QString("%1 iterations, %2 saved by warm start, ")
+                .arg(stats.getMeanIterations(), 0, 'f', 1)
+                .arg(iterations_saved);
+    }
+    // render frame rate and p95 frame and paint times
+    RenderScheduler *render = this->canvas_->render_scheduler_;
+    QString frame_msecs = "-";
+    if (render->getFrameTimes().getCount() > 0) {
+        frame_msecs = QString::number(
+                    render->getFrameTimes().percentile(0.95) / 1e6, 'f', 1);
+    }
+    QString paint_msecs = "-";
+    if (render->getPaintTimes().getCount() > 0) {
+        paint_msecs = QString::number(
+                    render->getPaintTimes().percentile(0.95) / 1e6, 'f', 1);
+    }
+
+    // telemetry samples dropped before reaching drone model
+    TelemetryStats telemetry = this->controller_->getCurrTelemetryStats();
+
+    this->stats_label_->setText(
+                QString("%1 replans, %2 per second\n"
+                        "%3%4% infeasible\n"
+                        "%5 fps, p95 frame %6 ms, paint %7 ms\n"
+                        "%8 of %9 packets applied, %10 stale, %11 lost, "
+                        "%12 resyncs, jitter %13 ms")
+                .arg(stats.getReplans())
+                .arg(stats.getReplanRate(), 0, 'f', 1)
+                .arg(iterations)
+                .arg(100 * stats.getInfeasibleRate(), 0, 'f', 1)
+                .arg(render->getFrameRate(), 0, 'f', 1)
+                .arg(frame_msecs)
+                .arg(paint_msecs)
+                .arg(telemetry.applied)
+                .arg(telemetry.received)
+                .arg(telemetry.stale)
+                .arg(telemetry.lost)
+                .arg(telemetry.resyncs)
+                .arg(telemetry.jitter_msecs, 0, 'f', 1));
+}
+
+void View::dumpPlannerStats() {
+    QString filename = this->controller_->dumpPlannerStats();
+    if (filename.isEmpty()) {
+        this->stats_label_->setText("Could not write stats file");
+    } else {
+        this->stats_label_->setText("Stats saved to " + filename);
+    }
 }
 
 void View::initializeFinaltime(MenuPanel *panel) {
@@ -1242,7 +1575,7 @@ void View::initializeFinaltime(MenuPanel *panel) {
     opt_finaltime->setSingleStep(1.0);
     opt_finaltime->setRange(0.0, 100.0);
     opt_finaltime->setSuffix("s");
-    opt_finaltime->setValue(skyenet::params().tf);
+    opt_finaltime->setValue(TrajectoryProblem().tf);
     opt_finaltime->setToolTip(tr("Set final time"));
     opt_finaltime->setMinimumHeight(40);
     opt_finaltime->setStyleSheet("QDoubleSpinBox::up-button "
@@ -1325,6 +1658,106 @@ void View::initializeDataCaptureToggle(MenuPanel *panel) {
             this, SLOT(toggleDataCapture(int)));
 }
 
+void View::initializeWarmStartToggle(MenuPanel *panel) {
+    QCheckBox *warm_start_toggle =
+            new QCheckBox("Warm Start", panel->menu_);
+    warm_start_toggle->
+            setToolTip(tr("Keep solver state between solves while the "
+                          "drone follows the last trajectory. Only the "
+                          "reference solver is also seeded with the rest "
+                          "of that trajectory"));
+    warm_start_toggle->setMinimumHeight(35);
+    warm_start_toggle->setCheckState(Qt::Checked);
+    panel->menu_->layout()->addWidget(warm_start_toggle);
+    panel->menu_->layout()->setAlignment(
+                warm_start_toggle, Qt::AlignBottom);
+
+    this->panel_widgets_.append(warm_start_toggle);
+
+    // Connect warm start toggle
+    connect(warm_start_toggle, SIGNAL(stateChanged(int)),
+            this, SLOT(toggleWarmStart(int)));
+}
+
+void View::initializeReferenceSolverToggle(MenuPanel *panel) {
+    QCheckBox *reference_solver_toggle =
+            new QCheckBox("Reference Solver", panel->menu_);
+    reference_solver_toggle->
+            setToolTip(tr("Solve with the built in reference solver "
+                          "instead of SkyeFly. A baseline that bends "
+                          "cubic segments around obstacles and planes, "
+                          "it does not optimize the trajectory"));
+    reference_solver_toggle->setMinimumHeight(35);
+    panel->menu_->layout()->addWidget(reference_solver_toggle);
+    panel->menu_->layout()->setAlignment(
+                reference_solver_toggle, Qt::AlignBottom);
+
+    this->panel_widgets_.append(reference_solver_toggle);
+
+    // Connect reference solver toggle
+    connect(reference_solver_toggle, SIGNAL(stateChanged(int)),
+            this, SLOT(toggleReferenceSolver(int)));
+}
+
+void View::initializePartialUpdatesToggle(MenuPanel *panel) {
+    QCheckBox *partial_updates_toggle =
+            new QCheckBox("Partial Updates", panel->menu_);
+    partial_updates_toggle->
+            setToolTip(tr("Index graphics and only repaint "
+                          "changed areas"));
+    partial_updates_toggle->setMinimumHeight(35);
+    panel->menu_->layout()->addWidget(partial_updates_toggle);
+    panel->menu_->layout()->setAlignment(
+                partial_updates_toggle, Qt::AlignBottom);
+
+    this->panel_widgets_.append(partial_updates_toggle);
+
+    // Connect partial updates toggle
+    connect(partial_updates_toggle, SIGNAL(stateChanged(int)),
+            this, SLOT(togglePartialUpdates(int)));
+}
+
+void View::initializeOpenGLViewportToggle(MenuPanel *panel) {
+    QCheckBox *opengl_toggle = new QCheckBox("OpenGL", panel->menu_);
+    opengl_toggle->
+            setToolTip(tr("Render with OpenGL instead of the "
+                          "raster painter"));
+    opengl_toggle->setMinimumHeight(35);
+    panel->menu_->layout()->addWidget(opengl_toggle);
+    panel->menu_->layout()->setAlignment(
+                opengl_toggle, Qt::AlignBottom);
+
+    this->panel_widgets_.append(opengl_toggle);
+
+    // Connect opengl toggle
+    connect(opengl_toggle, SIGNAL(stateChanged(int)),
+            this, SLOT(toggleOpenGLViewport(int)));
+}
+
+void View::initializeHistoryScrubber(MenuPanel *panel) {
+    this->history_label_ = new QLabel(panel->menu_);
+    panel->menu_->layout()->addWidget(this->history_label_);
+    panel->menu_->layout()->setAlignment(
+                this->history_label_, Qt::AlignBottom);
+
+    QSlider *history_slider = new QSlider(Qt::Horizontal, panel->menu_);
+    history_slider->setToolTip(tr("Step back through past trajectories"));
+    history_slider->setRange(0, TRAJ_HISTORY_SIZE - 1);
+    history_slider->setValue(0);
+    history_slider->setMinimumHeight(35);
+    panel->menu_->layout()->addWidget(history_slider);
+    panel->menu_->layout()->setAlignment(
+                history_slider, Qt::AlignBottom);
+
+    this->panel_widgets_.append(this->history_label_);
+    this->panel_widgets_.append(history_slider);
+
+    // Connect history scrubber
+    connect(history_slider, SIGNAL(valueChanged(int)),
+            this, SLOT(setHistoryAge(int)));
+    this->setHistoryAge(0);
+}
+
 void View::initializeFreeFinalTimeToggle(MenuPanel *panel) {
     QCheckBox *free_final_time_toggle =
             new QCheckBox("Free Final Time", panel->menu_);
@@ -1428,6 +1861,7 @@ void View::updateFeedbackMessage() {
     INPUT_CODE input_code =
             this->controller_->getIsValidInput();
 
+
     // update message from feasibility codes
     if (input_code == INPUT_CODE::VALID_INPUT) {
         switch (feasibility_code) {
@@ -8,9 +8,9 @@
 #include <QtMath>
 #include <QPen>
 #include <QGraphicsScene>
-#include <QGraphicsView>
 
 #include "include/globals.h"
+#include "include/graphics/canvas.h"
 
 namespace optgui {
 
@@ -22,13 +22,15 @@ WaypointGraphicsItem::WaypointGraphicsItem(PointModelItem *model,
     // set data model
     this->model_ = model;
 
-    // set graphical info
+    // set graphical info, widths scaled by zoom
     this->pen_ = QPen(Qt::black);
-    this->pen_.setWidthF(3);
+    this->selected_pen_ = QPen(Qt::black);
     this->brush_ = QBrush(Qt::white);
 
     // set size of waypoint
     this->radius_ = radius;
+    this->scaling_factor_ = 1;
+    this->updateZoomStyle();
 
     // set ordering of waypoint
     this->index_ = index;
@@ -39,14 +41,14 @@ WaypointGraphicsItem::WaypointGraphicsItem(PointModelItem *model,
                    QGraphicsItem::ItemSendsGeometryChanges);
 
     // Set position
+    this->synced_generation_ = this->model_->getGeneration();
+    this->syncing_ = false;
     this->setPos(this->model_->getPos());
 }
 
 QRectF WaypointGraphicsItem::boundingRect() const {
     // get rough area circle scaled by zoom factor
-    qreal scaling_factor = this->getScalingFactor();
-    qreal rad = this->radius_ / scaling_factor;
-    return QRectF(-rad, -rad, rad * 2, rad * 2);
+    return this->bounding_rect_;
 }
 
 void WaypointGraphicsItem::paint(QPainter *painter,
@@ -56,43 +58,30 @@ void WaypointGraphicsItem::paint(QPainter *painter,
     Q_UNUSED(option);
     Q_UNUSED(widget);
 
-    // scale with view
-    qreal scaling_factor = this->getScalingFactor();
-
-    // update graphic with pos from data model
-    this->setPos(this->model_->getPos());
-
     // Show handles if selected
     if (this->isSelected()) {
-        this->pen_.setWidthF(3.0 / scaling_factor);
+        painter->setPen(this->selected_pen_);
     } else {
-        this->pen_.setWidthF(1.0 / scaling_factor);
+        painter->setPen(this->pen_);
     }
 
-    painter->setPen(this->pen_);
-
     // Draw shape
-    painter->fillPath(this->shape(), this->brush_);
-    qreal rad = this->radius_ / scaling_factor;
-    painter->drawEllipse(QRectF(-rad, -rad, rad * 2, rad * 2));
+    painter->fillPath(this->shape_, this->brush_);
+    painter->drawEllipse(this->bounding_rect_);
 
     // Draw label
     painter->setPen(BLACK);
-    QFont font = painter->font();
 
     if (this->model_->port_ == 0) {
         // label with index
-        font.setPointSizeF(14 / scaling_factor);
-        painter->setFont(font);
-        painter->drawText(this->boundingRect(), Qt::AlignCenter,
+        painter->setFont(this->index_font_);
+        painter->drawText(this->bounding_rect_, Qt::AlignCenter,
                           QString::number(this->index_ + 1));
     } else {
         // Or label with port
         QPointF text_pos(this->mapFromScene(this->model_->getPos()));
-        QFont font = painter->font();
-        font.setPointSizeF(10 / scaling_factor);
-        painter->setFont(font);
-        qreal text_box_size = 50.0 / scaling_factor;
+        painter->setFont(this->port_font_);
+        qreal text_box_size = 50.0 / this->scaling_factor_;
         painter->drawText(text_pos.x() - text_box_size,
                           text_pos.y() - text_box_size,
                           text_box_size * 2, text_box_size * 2,
@@ -108,9 +97,30 @@ void WaypointGraphicsItem::setIndex(quint32 index) {
 
 QPainterPath WaypointGraphicsItem::shape() const {
     // get shape of circle to draw
-    QPainterPath path;
-    path.addEllipse(this->boundingRect());
-    return path;
+    return this->shape_;
+}
+
+void WaypointGraphicsItem::setScalingFactor(qreal scaling_factor) {
+    if (scaling_factor == this->scaling_factor_) {
+        return;
+    }
+    // circle scales with zoom
+    this->prepareGeometryChange();
+    this->scaling_factor_ = scaling_factor;
+    this->updateZoomStyle();
+}
+
+void WaypointGraphicsItem::updateZoomStyle() {
+    // keep pens, label and circle same size on screen
+    this->pen_.setWidthF(1.0 / this->scaling_factor_);
+    this->selected_pen_.setWidthF(3.0 / this->scaling_factor_);
+    this->index_font_.setPointSizeF(14 / this->scaling_factor_);
+    this->port_font_.setPointSizeF(10 / this->scaling_factor_);
+
+    qreal rad = this->radius_ / this->scaling_factor_;
+    this->bounding_rect_ = QRectF(-rad, -rad, rad * 2, rad * 2);
+    this->shape_ = QPainterPath();
+    this->shape_.addEllipse(this->bounding_rect_);
 }
 
 int WaypointGraphicsItem::type() const {
@@ -118,9 +128,30 @@ int WaypointGraphicsItem::type() const {
     return WAYPOINT_GRAPHIC;
 }
 
+void WaypointGraphicsItem::syncFromModel() {
+    // read generation before pos so a concurrent change
+    // is picked up by the next sync
+    quint64 generation = this->model_->getGeneration();
+    if (generation == this->synced_generation_) {
+        return;
+    }
+    this->synced_generation_ = generation;
+
+    this->syncing_ = true;
+    this->setPos(this->model_->getPos());
+    this->syncing_ = false;
+}
+
 QVariant WaypointGraphicsItem::itemChange(GraphicsItemChange change,
                                        const QVariant &value) {
-    if (change == ItemPositionChange && scene()) {
+    if (change == ItemSceneHasChanged) {
+        // match zoom of canvas added to
+        Canvas *canvas = qobject_cast<Canvas *>(this->scene());
+        if (canvas) {
+            this->setScalingFactor(canvas->getScalingFactor());
+        }
+    }
+    if (change == ItemPositionChange && scene() && !this->syncing_) {
         // value is the new position.
         QPointF newPos = value.toPointF();
 
@@ -133,13 +164,4 @@ QVariant WaypointGraphicsItem::itemChange(GraphicsItemChange change,
     return QGraphicsItem::itemChange(change, value);
 }
 
-qreal WaypointGraphicsItem::getScalingFactor() const {
-    // get zoom scaling factor from view
-    qreal scaling_factor = 1;
-    if (this->scene() && !this->scene()->views().isEmpty()) {
-        scaling_factor = this->scene()->views().first()->matrix().m11();
-    }
-    return scaling_factor;
-}
-
 }  // namespace optgui
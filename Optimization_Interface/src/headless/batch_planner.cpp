@@ -0,0 +1,107 @@
+// TITLE:   Optimization_Interface/src/headless/batch_planner.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/headless/batch_planner.h"
+
+#include <QRunnable>
+#include <QThread>
+#include <QFileInfo>
+#include <QTextStream>
+
+#include "include/headless/batch_scene.h"
+
+namespace optgui {
+
+// Plan one scene file on a pool thread
+class BatchJob : public QRunnable {
+ public:
+    BatchJob(BatchPlanner *planner, QString const &scene_file) {
+        this->planner_ = planner;
+        this->scene_file_ = scene_file;
+    }
+
+    void run() override {
+        this->planner_->planScene(this->scene_file_);
+    }
+
+ private:
+    BatchPlanner *planner_;
+    QString scene_file_;
+};
+
+BatchPlanner::BatchPlanner(QString const &output_dir,
+                           SOLVER_BACKEND backend, int threads) :
+    pool_(), output_dir_(output_dir), mutex_() {
+    this->backend_ = backend;
+    this->failures_ = 0;
+    // one worker per core unless limited
+    if (threads <= 0) {
+        threads = QThread::idealThreadCount();
+    }
+    this->pool_.setMaxThreadCount(threads);
+}
+
+BatchPlanner::~BatchPlanner() {
+    this->pool_.waitForDone();
+}
+
+int BatchPlanner::run(QStringList const &scene_files) {
+    {
+        QMutexLocker locker(&this->mutex_);
+        this->failures_ = 0;
+    }
+    if (!this->output_dir_.mkpath(".")) {
+        return scene_files.size();
+    }
+
+    for (QString const &scene_file : scene_files) {
+        this->pool_.start(new BatchJob(this, scene_file));
+    }
+    this->pool_.waitForDone();
+
+    QMutexLocker locker(&this->mutex_);
+    return this->failures_;
+}
+
+void BatchPlanner::planScene(QString const &scene_file) {
+    // each scene has its own model and solver, no state shared
+    // between pool threads
+    BatchScene scene;
+    QString error;
+    if (!scene.load(scene_file, &error)) {
+        this->report(scene_file, error, true);
+        return;
+    }
+
+    bool is_feasible = scene.plan(this->backend_);
+
+    // write traj next to other results with name of scene
+    QString output_file = this->output_dir_.filePath(
+                QFileInfo(scene_file).completeBaseName() + ".csv");
+    if (!scene.writeTrajectory(output_file)) {
+        this->report(scene_file, "cannot write " + output_file, true);
+        return;
+    }
+
+    this->report(scene_file,
+                 QString("%1 violation %2 solve %3 ms")
+                 .arg(is_feasible ? "feasible" : "infeasible")
+                 .arg(scene.getViolation())
+                 .arg(scene.getSolveMsecs()),
+                 false);
+}
+
+void BatchPlanner::report(QString const &scene_file,
+                          QString const &message, bool failed) {
+    QMutexLocker locker(&this->mutex_);
+    if (failed) {
+        this->failures_++;
+        QTextStream(stderr) << scene_file << ": " << message << endl;
+    } else {
+        QTextStream(stdout) << scene_file << ": " << message << endl;
+    }
+}
+
+}  // namespace optgui
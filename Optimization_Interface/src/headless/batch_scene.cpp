@@ -0,0 +1,249 @@
+// TITLE:   Optimization_Interface/src/headless/batch_scene.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/headless/batch_scene.h"
+
+#include <QFile>
+#include <QTextStream>
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QElapsedTimer>
+
+#include "include/models/params_cache.h"
+
+namespace optgui {
+
+// read [x, y] in meters as gui coords
+static bool readPoint(QJsonValue const &value, QPointF *point) {
+    QJsonArray coords = value.toArray();
+    if (coords.size() < 2) {
+        return false;
+    }
+    QVector3D gui_coords = xyzToGuiXyz(coords.at(0).toDouble(),
+                                       coords.at(1).toDouble(), 0);
+    *point = QPointF(gui_coords.x(), gui_coords.y());
+    return true;
+}
+
+// read [x, y, z] in meters as gui coords, z defaults to 0
+static bool readVector(QJsonValue const &value, QVector3D *vector) {
+    QJsonArray coords = value.toArray();
+    if (coords.size() < 2) {
+        return false;
+    }
+    *vector = xyzToGuiXyz(coords.at(0).toDouble(),
+                          coords.at(1).toDouble(),
+                          coords.at(2).toDouble(0));
+    return true;
+}
+
+// overwrite param only if scene sets it
+template <typename T>
+static void readParam(QJsonObject const &params, QString const &name,
+                      T *value) {
+    if (params.contains(name)) {
+        *value = static_cast<T>(params.value(name).toDouble());
+    }
+}
+
+BatchScene::BatchScene() : model_(), solver_(), outputs_() {
+    this->solve_msecs_ = 0;
+}
+
+bool BatchScene::load(QString const &filename, QString *error) {
+    QFile file(filename);
+    if (!file.open(QIODevice::ReadOnly)) {
+        *error = file.errorString();
+        return false;
+    }
+    QJsonParseError parse_error;
+    QJsonDocument document = QJsonDocument::fromJson(file.readAll(),
+                                                     &parse_error);
+    if (!document.isObject()) {
+        *error = parse_error.errorString();
+        return false;
+    }
+    QJsonObject scene = document.object();
+
+    // drone pos and target are required, drone starts at rest
+    QJsonObject drone = scene.value("drone").toObject();
+    if (!readVector(drone.value("pos"), &this->initial_pos_)) {
+        *error = "missing drone pos";
+        return false;
+    }
+    readVector(drone.value("vel"), &this->initial_vel_);
+    readVector(drone.value("accel"), &this->initial_acc_);
+
+    QPointF target;
+    if (!readPoint(scene.value("target"), &target)) {
+        *error = "missing target";
+        return false;
+    }
+    this->final_pos_ = QVector3D(target.x(), target.y(), 0);
+
+    // problem settings
+    this->loadParams(scene.value("params").toObject());
+    if (scene.contains("clearance")) {
+        this->model_.setClearance(scene.value("clearance").toDouble());
+    }
+    this->model_.setFreeFinalTime(
+                scene.value("free_final_time").toBool(false));
+
+    // ellipse obstacles, axes in meters and rotation in degrees
+    for (QJsonValue const &value : scene.value("ellipses").toArray()) {
+        QJsonObject ellipse = value.toObject();
+        QPointF pos;
+        if (!readPoint(ellipse.value("pos"), &pos)) {
+            *error = "missing ellipse pos";
+            return false;
+        }
+        EllipseModelItem *item = new EllipseModelItem(pos,
+                this->model_.getClearance(),
+                ellipse.value("height").toDouble(1) * GRID_SIZE,
+                ellipse.value("width").toDouble(1) * GRID_SIZE,
+                ellipse.value("rot").toDouble(0));
+        this->model_.addEllipse(item);
+    }
+
+    // polygon constraints
+    for (QJsonValue const &value : scene.value("polygons").toArray()) {
+        QJsonObject polygon = value.toObject();
+        QVector<QPointF> points;
+        for (QJsonValue const &coords : polygon.value("points").toArray()) {
+            QPointF point;
+            if (!readPoint(coords, &point)) {
+                *error = "invalid polygon point";
+                return false;
+            }
+            points.append(point);
+        }
+        if (points.size() < 3) {
+            *error = "polygon needs at least 3 points";
+            return false;
+        }
+        PolygonModelItem *item = new PolygonModelItem(points);
+        if (polygon.value("flip").toBool(false)) {
+            item->flipDirection();
+        }
+        this->model_.addPolygon(item);
+    }
+
+    // plane constraints
+    for (QJsonValue const &value : scene.value("planes").toArray()) {
+        QJsonObject plane = value.toObject();
+        QPointF p1;
+        QPointF p2;
+        if (!readPoint(plane.value("p1"), &p1) ||
+                !readPoint(plane.value("p2"), &p2)) {
+            *error = "missing plane point";
+            return false;
+        }
+        PlaneModelItem *item = new PlaneModelItem(p1, p2);
+        if (plane.value("flip").toBool(false)) {
+            item->flipDirection();
+        }
+        this->model_.addPlane(item);
+    }
+
+    // waypoints in order
+    for (QJsonValue const &value : scene.value("waypoints").toArray()) {
+        QPointF pos;
+        if (!readPoint(value, &pos)) {
+            *error = "invalid waypoint";
+            return false;
+        }
+        PointModelItem *item = new PointModelItem(pos);
+        this->model_.addWaypoint(item);
+    }
+
+    return true;
+}
+
+void BatchScene::loadParams(QJsonObject const &params) {
+    TrajectoryProblem P = this->model_.getSkyeFlyParams();
+
+    // same params as expert panel table
+    readParam(params, "K", &P.K);
+    readParam(params, "tf", &P.tf);
+    readParam(params, "a_min", &P.a_min);
+    readParam(params, "a_max", &P.a_max);
+    readParam(params, "v_max", &P.v_max);
+    readParam(params, "v_max_slow", &P.v_max_slow);
+    readParam(params, "theta_max", &P.theta_max);
+    readParam(params, "j_max", &P.j_max);
+    readParam(params, "delta", &P.delta);
+    readParam(params, "max_iter", &P.max_iter);
+    readParam(params, "lambda", &P.lambda);
+    readParam(params, "ri_relax", &P.ri_relax);
+    readParam(params, "rf_relax", &P.rf_relax);
+    readParam(params, "wp_relax", &P.wp_relax);
+    readParam(params, "trust_tau_weight", &P.trust_tau_weight);
+    readParam(params, "trust_delta_weight", &P.trust_delta_weight);
+
+    this->model_.setSkyeFlyParams(P);
+}
+
+bool BatchScene::plan(SOLVER_BACKEND backend) {
+    // build problem with same loading code as drone planners
+    std::shared_ptr<SceneSnapshot const> scene = this->model_.getSnapshot();
+    TrajectoryProblem P;
+    ParamsCache cache;
+    scene->loadSkyeFlyParams(&P, &cache);
+    scene->loadEllipseConstraints(&P);
+    scene->loadPosConstraints(&P);
+    scene->loadWaypointConstraints(&P);
+
+    TrajectoryInputs inputs(this->initial_pos_, this->initial_vel_,
+                            this->initial_acc_, this->final_pos_);
+
+    // every scene starts cold
+    this->solver_.reset(TrajectorySolver::create(backend));
+    this->solver_->setProblem(P, inputs);
+    this->solver_->resetInputs();
+
+    QElapsedTimer solve_timer;
+    solve_timer.start();
+    this->outputs_ = this->solver_->solve(scene->is_free_final_time_);
+    this->solve_msecs_ = solve_timer.elapsed();
+
+    return this->outputs_.violation <= FEASIBILITY_TOLERANCE;
+}
+
+bool BatchScene::writeTrajectory(QString const &filename) {
+    QFile file(filename);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return false;
+    }
+    QTextStream stream(&file);
+
+    stream << "rel_time,"
+           << "pos_ref_n,pos_ref_e,pos_ref_d,"
+           << "vel_ref_n,vel_ref_e,vel_ref_d,"
+           << "accl_ref_n,accl_ref_e,accl_ref_d"
+           << endl;
+
+    // XYZ to NED conversion
+    for (int i = 0; i < this->outputs_.r.size(); i++) {
+        QVector3D const &r = this->outputs_.r.at(i);
+        QVector3D const &v = this->outputs_.v.at(i);
+        QVector3D const &a = this->outputs_.a.at(i);
+        stream << this->outputs_.t.at(i) << ","
+               << r.y() << "," << r.x() << "," << -r.z() << ","
+               << v.y() << "," << v.x() << "," << -v.z() << ","
+               << a.y() << "," << a.x() << "," << -a.z()
+               << endl;
+    }
+    return true;
+}
+
+qint64 BatchScene::getSolveMsecs() {
+    return this->solve_msecs_;
+}
+
+double BatchScene::getViolation() {
+    return this->outputs_.violation;
+}
+
+}  // namespace optgui
@@ -0,0 +1,108 @@
+// TITLE:   Optimization_Interface/src/headless/main.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Plans trajectories for scene files without a display
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QImageReader>
+#include <QFileInfo>
+#include <QDir>
+#include <QTextStream>
+
+#include "include/headless/batch_planner.h"
+#include "include/graphics/basemap_file.h"
+#include "include/globals.h"
+
+using optgui::BatchPlanner;
+using optgui::BasemapFile;
+
+// convert image to tiled basemap in output dir, bounds given as
+// bottom left x,y and top right x,y in meters
+static bool makeBasemap(QString const &image_file, QString const &bounds,
+                        QString const &output_dir) {
+    QTextStream err(stderr);
+
+    QStringList values = bounds.split(',');
+    if (values.size() != 4) {
+        err << "Bounds must be x0,y0,x1,y1" << endl;
+        return false;
+    }
+
+    // image is decoded a tile at a time while writing
+    QImageReader reader(image_file);
+    if (!reader.canRead()) {
+        err << image_file << ": " << reader.errorString() << endl;
+        return false;
+    }
+
+    QString filename = QDir(output_dir).filePath(
+                QFileInfo(image_file).completeBaseName() +
+                optgui::BASEMAP_SUFFIX);
+    if (!BasemapFile::write(image_file,
+                            QPointF(values.at(0).toDouble(),
+                                    values.at(1).toDouble()),
+                            QPointF(values.at(2).toDouble(),
+                                    values.at(3).toDouble()),
+                            filename)) {
+        err << "Could not write " << filename << endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("Optimization_Interface_Headless");
+
+    // parse command line
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+                "Plan trajectories for json scene files in parallel");
+    parser.addHelpOption();
+    parser.addPositionalArgument("scenes", "Scene files to plan.",
+                                 "scenes...");
+    QCommandLineOption output_option(QStringList() << "o" << "output",
+            "Directory for trajectory csv files.", "dir", ".");
+    QCommandLineOption threads_option(QStringList() << "j" << "threads",
+            "Number of scenes planned at once, 0 for one per core.",
+            "threads", "0");
+    QCommandLineOption reference_option("reference",
+            "Solve with the built in reference solver instead of SkyeFly, "
+            "a non optimizing baseline.");
+    parser.addOption(output_option);
+    parser.addOption(threads_option);
+    QCommandLineOption basemap_option("make-basemap",
+            "Convert image to a tiled basemap in the output directory "
+            "instead of planning.", "image");
+    QCommandLineOption bounds_option("bounds",
+            "Basemap bounds in meters, bottom left and top right corners.",
+            "x0,y0,x1,y1", "0,0,1,1");
+    parser.addOption(reference_option);
+    parser.addOption(basemap_option);
+    parser.addOption(bounds_option);
+    parser.process(app);
+
+    if (parser.isSet(basemap_option)) {
+        return makeBasemap(parser.value(basemap_option),
+                           parser.value(bounds_option),
+                           parser.value(output_option)) ? 0 : 1;
+    }
+
+    QStringList scene_files = parser.positionalArguments();
+    if (scene_files.isEmpty()) {
+        parser.showHelp(1);
+    }
+
+    // Plan all scenes
+    BatchPlanner planner(parser.value(output_option),
+                         parser.isSet(reference_option) ?
+                             optgui::REFERENCE_SOLVER :
+                             optgui::SKYEFLY_SOLVER,
+                         parser.value(threads_option).toInt());
+    int failures = planner.run(scene_files);
+
+    return failures == 0 ? 0 : 1;
+}
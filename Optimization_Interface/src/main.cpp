@@ -15,6 +15,16 @@ int main(int argc, char *argv[]) {
     // allow custom packets to be used in signal/slot definitions
     qRegisterMetaType<autogen::packet::traj3dof>("autogen::packet::traj3dof");
     qRegisterMetaType<autogen::packet::telemetry>("autogen::packet::telemetry");
+    // models passed to sockets on network thread
+    qRegisterMetaType<optgui::DroneModelItem *>("DroneModelItem*");
+    qRegisterMetaType<optgui::Traj3dofPtr>("Traj3dofPtr");
+
+    // render opengl viewport with software rasterizer when set,
+    // for machines without a gpu such as ci runners
+    if (qEnvironmentVariableIsSet("OPTGUI_SOFTWARE_GL")) {
+        qputenv("LIBGL_ALWAYS_SOFTWARE", "1");
+        QApplication::setAttribute(Qt::AA_UseSoftwareOpenGL);
+    }
 
     // Initialize application
     QApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
@@ -6,7 +6,6 @@
 #include "include/models/constraint_model.h"
 
 #include <QString>
-#include <QLineF>
 #include <QSpinBox>
 #include <QDoubleSpinBox>
 #include <QtMath>
@@ -18,7 +17,8 @@
 
 namespace optgui {
 
-ConstraintModel::ConstraintModel() : model_lock_(), P_() {
+ConstraintModel::ConstraintModel() : model_lock_(), notifier_(),
+    scene_notifier_(&this->notifier_), snapshot_(), P_() {
     // Set model containers
     this->curr_drone_ = nullptr;
     this->staged_drone_ = nullptr;
@@ -32,10 +32,24 @@ ConstraintModel::ConstraintModel() : model_lock_(), P_() {
     // in meters
     this->clearance_ = INIT_CLEARANCE;
 
+    // start ahead of params caches so first load copies params
+    this->params_revision_ = 1;
+    this->constraints_revision_ = 0;
+
+    // no limit on replan rate by default
+    this->max_replan_rate_ = 0;
+
     // initialize live reference mode to disable updating
     // current trajectory
     this->is_live_reference_ = false;
     this->is_free_final_time_ = false;
+
+    // keep solver state and seed solves with rest of last traj
+    // while drone follows it by default
+    this->is_warm_start_ = true;
+
+    // solve with skyefly by default
+    this->solver_backend_ = SKYEFLY_SOLVER;
 }
 
 ConstraintModel::~ConstraintModel() {
@@ -83,11 +97,15 @@ ConstraintModel::~ConstraintModel() {
 void ConstraintModel::addPoint(PointModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->final_points_.insert(item);
+    item->setNotifier(&this->notifier_);
+    this->notifier_.notify();
 }
 
 void ConstraintModel::removePoint(PointModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->final_points_.remove(item);
+    item->setNotifier(nullptr);
+    this->notifier_.notify();
 }
 
 void ConstraintModel::addDrone(DroneModelItem *drone, PathModelItem *traj) {
@@ -95,6 +113,8 @@ void ConstraintModel::addDrone(DroneModelItem *drone, PathModelItem *traj) {
     this->drones_.insert(drone,
                          QPair<PathModelItem *, autogen::packet::traj3dof>
                                 (traj, autogen::packet::traj3dof()));
+    drone->setNotifier(&this->notifier_);
+    this->notifier_.notify();
 }
 
 void ConstraintModel::removeDrone(DroneModelItem *item) {
@@ -104,46 +124,70 @@ void ConstraintModel::removeDrone(DroneModelItem *item) {
         this->curr_drone_ = nullptr;
     }
     this->drones_.remove(item);
+    item->setNotifier(nullptr);
+    this->notifier_.notify();
 }
 
 void ConstraintModel::addEllipse(EllipseModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->ellipses_.insert(item);
+    this->constraints_revision_++;
+    item->setNotifier(&this->scene_notifier_);
+    this->scene_notifier_.notify();
 }
 
 void ConstraintModel::removeEllipse(EllipseModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->ellipses_.remove(item);
+    this->constraints_revision_++;
+    item->setNotifier(nullptr);
+    this->scene_notifier_.notify();
 }
 
 void ConstraintModel::addPolygon(PolygonModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->polygons_.insert(item);
+    this->constraints_revision_++;
+    item->setNotifier(&this->scene_notifier_);
+    this->scene_notifier_.notify();
 }
 
 void ConstraintModel::removePolygon(PolygonModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->polygons_.remove(item);
+    this->constraints_revision_++;
+    item->setNotifier(nullptr);
+    this->scene_notifier_.notify();
 }
 
 void ConstraintModel::addPlane(PlaneModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->planes_.insert(item);
+    this->constraints_revision_++;
+    item->setNotifier(&this->scene_notifier_);
+    this->scene_notifier_.notify();
 }
 
 void ConstraintModel::removePlane(PlaneModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->planes_.remove(item);
+    this->constraints_revision_++;
+    item->setNotifier(nullptr);
+    this->scene_notifier_.notify();
 }
 
 void ConstraintModel::addWaypoint(PointModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->waypoints_.append(item);
+    item->setNotifier(&this->scene_notifier_);
+    this->scene_notifier_.notify();
 }
 
 void ConstraintModel::removeWaypoint(PointModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->waypoints_.removeOne(item);
+    item->setNotifier(nullptr);
+    this->scene_notifier_.notify();
 }
 
 quint32 ConstraintModel::getNumWaypoints() {
@@ -155,6 +199,7 @@ quint32 ConstraintModel::getNumWaypoints() {
 void ConstraintModel::reverseWaypoints() {
     QMutexLocker locker(&this->model_lock_);
     std::reverse(this->waypoints_.begin(), this->waypoints_.end());
+    this->scene_notifier_.notify();
 }
 
 void ConstraintModel::setPathStagedModel(PathModelItem *trajectory) {
@@ -213,7 +258,15 @@ qreal ConstraintModel::getFinaltime() {
 
 void ConstraintModel::setFinaltime(qreal finaltime) {
     QMutexLocker locker(&this->model_lock_);
+    // free final time is solver output, only wake on user input
+    bool changed = !this->is_free_final_time_ && this->P_.tf != finaltime;
+    if (this->P_.tf != finaltime) {
+        this->params_revision_++;
+    }
     this->P_.tf = finaltime;
+    if (changed) {
+        this->scene_notifier_.notify();
+    }
 }
 
 autogen::packet::traj3dof
@@ -293,10 +346,14 @@ void ConstraintModel::setIsValidTraj(FEASIBILITY_CODE code) {
 
 void ConstraintModel::setClearance(qreal clearance) {
     QMutexLocker locker(&this->model_lock_);
+    if (clearance == this->clearance_) {
+        return;
+    }
     for (EllipseModelItem *ellipse : this->ellipses_) {
         ellipse->setClearance(clearance);
     }
     this->clearance_ = clearance;
+    this->scene_notifier_.notify();
 }
 
 quint32 ConstraintModel::getHorizon() {
@@ -307,6 +364,8 @@ quint32 ConstraintModel::getHorizon() {
 void ConstraintModel::setHorizon(quint32 horizon) {
     QMutexLocker locker(&this->model_lock_);
     this->P_.K = horizon;
+    this->params_revision_++;
+    this->scene_notifier_.notify();
 }
 
 bool ConstraintModel::isLiveReference() {
@@ -316,7 +375,10 @@ bool ConstraintModel::isLiveReference() {
 
 void ConstraintModel::setLiveReferenceMode(bool reference_mode) {
     QMutexLocker locker(&this->model_lock_);
-    this->is_live_reference_ = reference_mode;
+    if (reference_mode != this->is_live_reference_) {
+        this->is_live_reference_ = reference_mode;
+        this->scene_notifier_.notify();
+    }
 }
 
 bool ConstraintModel::isFreeFinalTime() {
@@ -327,6 +389,33 @@ bool ConstraintModel::isFreeFinalTime() {
 void ConstraintModel::setFreeFinalTime(bool free_final_time) {
     QMutexLocker locker(&this->model_lock_);
     this->is_free_final_time_ = free_final_time;
+    this->scene_notifier_.notify();
+}
+
+bool ConstraintModel::isWarmStart() {
+    QMutexLocker locker(&this->model_lock_);
+    return this->is_warm_start_;
+}
+
+void ConstraintModel::setWarmStart(bool warm_start) {
+    QMutexLocker locker(&this->model_lock_);
+    if (warm_start != this->is_warm_start_) {
+        this->is_warm_start_ = warm_start;
+        this->scene_notifier_.notify();
+    }
+}
+
+SOLVER_BACKEND ConstraintModel::getSolverBackend() {
+    QMutexLocker locker(&this->model_lock_);
+    return this->solver_backend_;
+}
+
+void ConstraintModel::setSolverBackend(SOLVER_BACKEND backend) {
+    QMutexLocker locker(&this->model_lock_);
+    if (backend != this->solver_backend_) {
+        this->solver_backend_ = backend;
+        this->scene_notifier_.notify();
+    }
 }
 
 void ConstraintModel::setCurrDrone(DroneModelItem *drone) {
@@ -352,8 +441,8 @@ bool ConstraintModel::isCurrDrone(DroneModelItem *drone) {
 void ConstraintModel::setSkyeFlyParams(QTableWidget *params_table) {
     QMutexLocker locker(&this->model_lock_);
 
-    // load skyenet::params from  expert panel table
-    uint32 row_index = 0;
+    // load problem params from  expert panel table
+    quint32 row_index = 0;
     this->P_.K = qobject_cast<QSpinBox *>
             (params_table->cellWidget(row_index++, 0))->value();
     // no longer in expert panel table
@@ -401,9 +490,19 @@ void ConstraintModel::setSkyeFlyParams(QTableWidget *params_table) {
             (params_table->cellWidget(row_index++, 0))->value();
 //    this->P_.wp_idx[0] = qobject_cast<QSpinBox *>
 //            (params_table->cellWidget(row_index++, 0))->value();
+
+    this->params_revision_++;
+    this->scene_notifier_.notify();
+}
+
+void ConstraintModel::setSkyeFlyParams(TrajectoryProblem const &P) {
+    QMutexLocker locker(&this->model_lock_);
+    this->P_ = P;
+    this->params_revision_++;
+    this->scene_notifier_.notify();
 }
 
-skyenet::params ConstraintModel::getSkyeFlyParams() {
+TrajectoryProblem ConstraintModel::getSkyeFlyParams() {
     QMutexLocker locker(&this->model_lock_);
 
     // time intervals
@@ -523,6 +622,57 @@ void ConstraintModel::fillTable(QTableWidget *port_table,
 //    }
 }
 
+qreal ConstraintModel::getMaxReplanRate() {
+    QMutexLocker locker(&this->model_lock_);
+    return this->max_replan_rate_;
+}
+
+void ConstraintModel::setMaxReplanRate(qreal rate) {
+    QMutexLocker locker(&this->model_lock_);
+    this->max_replan_rate_ = rate;
+    this->scene_notifier_.notify();
+}
+
+quint64 ConstraintModel::getRevision() {
+    // notifier is thread safe, no need to lock model
+    return this->notifier_.getRevision();
+}
+
+quint64 ConstraintModel::getSceneRevision() {
+    return this->scene_notifier_.getRevision();
+}
+
+std::shared_ptr<SceneSnapshot const> ConstraintModel::getSnapshot() {
+    // lock free fast path while scene is unchanged
+    quint64 revision = this->scene_notifier_.getRevision();
+    std::shared_ptr<SceneSnapshot const> snapshot =
+            std::atomic_load(&this->snapshot_);
+    if (snapshot && snapshot->revision_ == revision) {
+        return snapshot;
+    }
+
+    QMutexLocker locker(&this->model_lock_);
+    // another thread may have published while waiting for lock
+    snapshot = std::atomic_load(&this->snapshot_);
+    if (snapshot &&
+            snapshot->revision_ == this->scene_notifier_.getRevision()) {
+        return snapshot;
+    }
+    snapshot = std::shared_ptr<SceneSnapshot const>(this->buildSnapshot());
+    std::atomic_store(&this->snapshot_, snapshot);
+    return snapshot;
+}
+
+quint64 ConstraintModel::waitForChange(quint64 revision,
+                                       unsigned long timeout) {
+    // do not hold model lock while blocking
+    return this->notifier_.waitForChange(revision, timeout);
+}
+
+void ConstraintModel::notifyChange() {
+    this->notifier_.notify();
+}
+
 qreal ConstraintModel::getClearance() {
     QMutexLocker locker(&this->model_lock_);
     return this->clearance_;
@@ -565,157 +715,68 @@ void ConstraintModel::updateEllipseColors() {
     }
 }
 
-void ConstraintModel::loadWaypointConstraints(
-            skyenet::params *P,
-            double wp[skyenet::MAX_WAYPOINTS][3]) {
-    QMutexLocker locker(&this->model_lock_);
-
-    P->n_wp = this->waypoints_.size();
-    // no waypoints, dont factor in relaxation
-    if (P->n_wp == 0) {
-        P->wp_relax = 0;
-        return;
-    }
-
-    // space out waypoint indicies
-    this->distributeWpEvenly(P, 0, P->n_wp, 1, (P->K - 2));
-
-    // load waypoint pos
-    for (quint32 i = 0; i < P->n_wp; i++) {
-        QPointF wp_pos = this->waypoints_.at(i)->getPos();
-        QVector3D xyz_wp_pos = guiXyzToXyz(wp_pos.x(), wp_pos.y(), 0);
-        wp[i][0] = xyz_wp_pos.x();
-        wp[i][1] = xyz_wp_pos.y();
-    }
-}
-
-void ConstraintModel::loadEllipseConstraints(skyenet::params *P) {
-    QMutexLocker locker(&this->model_lock_);
+// ====== Private functions, do not lock ======
 
-    quint32 index = 0;
+SceneSnapshot *ConstraintModel::buildSnapshot() {
+    SceneSnapshot *snapshot = new SceneSnapshot();
+
+    // read revision first so changes made while copying
+    // trigger another build
+    snapshot->revision_ = this->scene_notifier_.getRevision();
+    snapshot->params_revision_ = this->params_revision_;
+    snapshot->constraints_revision_ = this->constraints_revision_;
+
+    snapshot->P_ = this->P_;
+    snapshot->clearance_ = this->clearance_;
+    snapshot->max_replan_rate_ = this->max_replan_rate_;
+    snapshot->is_live_reference_ = this->is_live_reference_;
+    snapshot->is_free_final_time_ = this->is_free_final_time_;
+    snapshot->is_warm_start_ = this->is_warm_start_;
+    snapshot->solver_backend_ = this->solver_backend_;
+
+    // copy constraints, reading generation before data so
+    // concurrent changes are never cached as loaded
+    snapshot->ellipses_.reserve(this->ellipses_.size());
+    snapshot->ellipse_regions_.reserve(this->ellipses_.size());
     for (EllipseModelItem *ellipse : this->ellipses_) {
-        // calculate ellipse matrix in meters
-
-        P->obs.R[index] = 1;
-        qreal a = (ellipse->getHeight() / GRID_SIZE) + this->clearance_;
-        qreal inv_a = 1.0 / a;
-        qreal b = (ellipse->getWidth() / GRID_SIZE) + this->clearance_;
-        qreal inv_b = 1.0 / b;
-        qreal t = ellipse->getRot();
-        qreal sin_t = qSin(qDegreesToRadians(t));
-        qreal cos_t = qCos(qDegreesToRadians(t));
-        qreal cos_t_2 = qPow(cos_t, 2);
-        qreal sin_t_2 = qPow(sin_t, 2);
-
-        P->obs.M0[0][index] = (inv_a * cos_t_2) + (inv_b * sin_t_2);
-        P->obs.M0[1][index] = (inv_a * sin_t * cos_t) - (inv_b * sin_t * cos_t);
-        P->obs.M1[0][index] = (inv_a * sin_t * cos_t) - (inv_b * sin_t * cos_t);
-        P->obs.M1[1][index] = (inv_a * sin_t_2) + (inv_b * cos_t_2);
-
-        QPointF ellipse_pos = ellipse->getPos();
-        QVector3D xyz_coords = guiXyzToXyz(ellipse_pos.x(), ellipse_pos.y(), 0);
-        P->obs.c_x[index] = xyz_coords.x();
-        P->obs.c_y[index] = xyz_coords.y();
-        index++;
-        // dont go over max
-        if (index >= skyenet::MAX_OBS) {
-            P->obs.n = index;
-            return;
-        }
+        EllipseData data;
+        data.item = ellipse;
+        data.generation = ellipse->getGeneration();
+        data.pos = ellipse->getPos();
+        data.width = ellipse->getWidth();
+        data.height = ellipse->getHeight();
+        data.rot = ellipse->getRot();
+        snapshot->ellipses_.append(data);
+        snapshot->ellipse_regions_.append(ellipse->getRegion());
     }
-    P->obs.n = index;
-}
-
-void ConstraintModel::loadPosConstraints(skyenet::params *P) {
-    QMutexLocker locker(&this->model_lock_);
 
-    quint32 index = 0;
+    snapshot->polygons_.reserve(this->polygons_.size());
     for (PolygonModelItem *polygon : this->polygons_) {
-        quint32 size = polygon->getSize();
-        for (quint32 i = 1; i < size + 1; i++) {
-            QPointF p_pos = polygon->getPointAt(i - 1);
-            QPointF q_pos = polygon->getPointAt(i % size);
-            QVector3D xyz_p = guiXyzToXyz(p_pos.x(), p_pos.y(), 0);
-            QVector3D xyz_q = guiXyzToXyz(q_pos.x(), q_pos.y(), 0);
-            if (polygon->getDirection()) {
-                this->loadPlaneConstraint(P, index, xyz_p, xyz_q);
-            } else {
-                this->loadPlaneConstraint(P, index, xyz_q, xyz_p);
-            }
-            index++;
-            // dont go over max
-            if (index >= skyenet::MAX_CPOS) {
-                P->cpos.n = index;
-                return;
-            }
-        }
+        PolygonData data;
+        data.item = polygon;
+        data.generation = polygon->getGeneration();
+        data.points = polygon->getPoints();
+        data.direction = polygon->getDirection();
+        snapshot->polygons_.append(data);
     }
 
+    snapshot->planes_.reserve(this->planes_.size());
     for (PlaneModelItem *plane : this->planes_) {
-        QPointF p1_pos = plane->getP1();
-        QPointF p2_pos = plane->getP2();
-        QVector3D xyz_p = guiXyzToXyz(p1_pos.x(), p1_pos.y(), 0);
-        QVector3D xyz_q = guiXyzToXyz(p2_pos.x(), p2_pos.y(), 0);
-
-        // choose direction of constraint
-        if (plane->getDirection()) {
-            this->loadPlaneConstraint(P, index, xyz_p, xyz_q);
-        } else {
-            this->loadPlaneConstraint(P, index, xyz_q, xyz_p);
-        }
-        index++;
-        // dont go over max
-        if (index >= skyenet::MAX_CPOS) {
-            P->cpos.n = index;
-            return;
-        }
+        PlaneData data;
+        data.item = plane;
+        data.generation = plane->getGeneration();
+        data.p1 = plane->getP1();
+        data.p2 = plane->getP2();
+        data.direction = plane->getDirection();
+        snapshot->planes_.append(data);
     }
-    P->cpos.n = index;
-}
-
-// ====== Private functions, do not lock ======
-
-void ConstraintModel::loadPlaneConstraint(skyenet::params *P, quint32 index,
-                                          QVector3D xyz_p, QVector3D xyz_q) {
-    qreal c = ((xyz_q.x() * xyz_p.y()) - (xyz_q.y() * xyz_p.x()));
-
-    qreal a1 = (xyz_q.x() - xyz_p.x()) / c;
-    qreal a2 = (xyz_q.y() - xyz_p.y()) / c * -1.0;
-
-    QLineF line(QPointF(xyz_q.x(), xyz_q.y()),
-                QPointF(xyz_p.x(), xyz_p.y()));
-    QPointF normal = line.normalVector().p2();
-    qreal flip = ((a1 * normal.y()) + (a2 * normal.x()) < 1) ? -1 : 1;
 
-    P->cpos.A[2 * index] = flip * a1;
-    P->cpos.A[(2 * index) + 1] = flip * a2;
-    P->cpos.b[index] = flip;
-}
-
-int ConstraintModel::distributeWpEvenly(skyenet::params *P,
-                                        int index, int remaining,
-                                        int low, int high) {
-    // recursively fill P->wp_index with evenly spaced indicies
-    if (remaining != 0) {
-        int mid = (low + high + 1) / 2;
-
-        bool place = false;
-        if (remaining % 2 != 0) {
-            place = true;
-            remaining--;
-        }
-
-        index = distributeWpEvenly(P, index, remaining / 2, low, mid - 1);
-
-        if (place) {
-            assert(P->wp_idx[index] == 0);
-            P->wp_idx[index] = mid;
-            index++;
-        }
-
-        index = distributeWpEvenly(P, index, remaining / 2, mid, high);
+    snapshot->waypoints_.reserve(this->waypoints_.size());
+    for (PointModelItem *waypoint : this->waypoints_) {
+        snapshot->waypoints_.append(waypoint->getPos());
     }
-    return index;
+
+    return snapshot;
 }
 
 }  // namespace optgui
@@ -0,0 +1,246 @@
+// TITLE:   Optimization_Interface/src/models/scene_snapshot.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/models/scene_snapshot.h"
+
+#include <QLineF>
+#include <QtMath>
+
+namespace optgui {
+
+SceneSnapshot::SceneSnapshot() : P_() {
+    this->revision_ = 0;
+    this->params_revision_ = 0;
+    this->constraints_revision_ = 0;
+    this->clearance_ = INIT_CLEARANCE;
+    this->max_replan_rate_ = 0;
+    this->is_live_reference_ = false;
+    this->is_free_final_time_ = false;
+    this->is_warm_start_ = true;
+    this->solver_backend_ = SKYEFLY_SOLVER;
+}
+
+void SceneSnapshot::loadSkyeFlyParams(TrajectoryProblem *P,
+                                      ParamsCache *cache) const {
+    if (cache->params_revision == this->params_revision_) {
+        return;
+    }
+    cache->params_revision = this->params_revision_;
+
+    // model params have no constraints loaded, keep the cached ones
+    QVector<EllipseObstacle> obstacles;
+    QVector<HalfPlane> planes;
+    obstacles.swap(P->obstacles);
+    planes.swap(P->planes);
+    *P = this->P_;
+    P->obstacles.swap(obstacles);
+    P->planes.swap(planes);
+}
+
+void SceneSnapshot::loadWaypointConstraints(TrajectoryProblem *P) const {
+    // reset values left from previous load of a persistent P
+    int n_wp = this->waypoints_.size();
+    P->waypoints.resize(n_wp);
+    for (int i = 0; i < n_wp; i++) {
+        P->waypoints[i].index = 0;
+    }
+
+    // space out waypoint indicies
+    this->distributeWpEvenly(P, 0, n_wp, 1, (P->K - 2));
+
+    // load waypoint pos
+    for (int i = 0; i < n_wp; i++) {
+        QPointF wp_pos = this->waypoints_.at(i);
+        QVector3D xyz_wp_pos = guiXyzToXyz(wp_pos.x(), wp_pos.y(), 0);
+        P->waypoints[i].r[0] = xyz_wp_pos.x();
+        P->waypoints[i].r[1] = xyz_wp_pos.y();
+        P->waypoints[i].r[2] = 0;
+    }
+}
+
+void SceneSnapshot::loadEllipseConstraints(TrajectoryProblem *P,
+                                           ParamsCache *cache) const {
+    // rebuild all slots if ellipses added or removed or clearance changed
+    if (cache && (cache->obs_revision != this->constraints_revision_ ||
+                  cache->clearance != this->clearance_)) {
+        cache->obs.clear();
+        cache->obs_revision = this->constraints_revision_;
+        cache->clearance = this->clearance_;
+    }
+
+    // resize keeps cached slots
+    P->obstacles.resize(qMin(quint32(this->ellipses_.size()), MAX_OBS));
+    quint32 index = 0;
+    for (EllipseData const &ellipse : this->ellipses_) {
+        // dont go over max
+        if (index >= MAX_OBS) {
+            break;
+        }
+        // keep slot if ellipse unchanged since last load
+        if (!cache || !this->checkCachedSlot(&cache->obs, index, ellipse.item,
+                                             ellipse.generation)) {
+            this->loadEllipseConstraint(P, index, ellipse);
+        }
+        index++;
+    }
+}
+
+void SceneSnapshot::loadPosConstraints(TrajectoryProblem *P,
+                                       ParamsCache *cache) const {
+    // rebuild all slots if polygons or planes added or removed
+    if (cache && cache->cpos_revision != this->constraints_revision_) {
+        cache->cpos.clear();
+        cache->cpos_revision = this->constraints_revision_;
+    }
+
+    // room for every slot, trimmed to slots loaded at end.
+    // resize keeps cached slots
+    P->planes.resize(MAX_CPOS);
+    quint32 index = 0;
+    int slot = 0;
+    for (PolygonData const &polygon : this->polygons_) {
+        // dont go over max
+        if (index >= MAX_CPOS) {
+            break;
+        }
+        quint32 size = polygon.points.size();
+        quint32 max_edges = MAX_CPOS - index;
+        quint32 edges = qMin(size, max_edges);
+
+        // keep slots if polygon unchanged since last load
+        if (!cache || !this->checkCachedSlot(&cache->cpos, slot, polygon.item,
+                                             polygon.generation)) {
+            for (quint32 i = 1; i < edges + 1; i++) {
+                QPointF p_pos = polygon.points.at(i - 1);
+                QPointF q_pos = polygon.points.at(i % size);
+                QVector3D xyz_p = guiXyzToXyz(p_pos.x(), p_pos.y(), 0);
+                QVector3D xyz_q = guiXyzToXyz(q_pos.x(), q_pos.y(), 0);
+                if (polygon.direction) {
+                    this->loadPlaneConstraint(P, index + i - 1,
+                                              xyz_p, xyz_q);
+                } else {
+                    this->loadPlaneConstraint(P, index + i - 1,
+                                              xyz_q, xyz_p);
+                }
+            }
+        }
+        index += edges;
+        slot++;
+    }
+
+    for (PlaneData const &plane : this->planes_) {
+        // dont go over max
+        if (index >= MAX_CPOS) {
+            break;
+        }
+
+        // keep slot if plane unchanged since last load
+        if (!cache || !this->checkCachedSlot(&cache->cpos, slot, plane.item,
+                                             plane.generation)) {
+            QVector3D xyz_p = guiXyzToXyz(plane.p1.x(), plane.p1.y(), 0);
+            QVector3D xyz_q = guiXyzToXyz(plane.p2.x(), plane.p2.y(), 0);
+
+            // choose direction of constraint
+            if (plane.direction) {
+                this->loadPlaneConstraint(P, index, xyz_p, xyz_q);
+            } else {
+                this->loadPlaneConstraint(P, index, xyz_q, xyz_p);
+            }
+        }
+        index++;
+        slot++;
+    }
+    P->planes.resize(index);
+}
+
+// ====== Private functions ======
+
+void SceneSnapshot::loadEllipseConstraint(TrajectoryProblem *P,
+                                          quint32 index,
+                                          EllipseData const &ellipse) const {
+    EllipseObstacle &obs = P->obstacles[index];
+    // calculate ellipse matrix in meters
+    obs.R = 1;
+    qreal a = (ellipse.height / GRID_SIZE) + this->clearance_;
+    qreal inv_a = 1.0 / a;
+    qreal b = (ellipse.width / GRID_SIZE) + this->clearance_;
+    qreal inv_b = 1.0 / b;
+    qreal t = ellipse.rot;
+    qreal sin_t = qSin(qDegreesToRadians(t));
+    qreal cos_t = qCos(qDegreesToRadians(t));
+    qreal cos_t_2 = qPow(cos_t, 2);
+    qreal sin_t_2 = qPow(sin_t, 2);
+
+    obs.M[0][0] = (inv_a * cos_t_2) + (inv_b * sin_t_2);
+    obs.M[0][1] = (inv_a * sin_t * cos_t) - (inv_b * sin_t * cos_t);
+    obs.M[1][0] = (inv_a * sin_t * cos_t) - (inv_b * sin_t * cos_t);
+    obs.M[1][1] = (inv_a * sin_t_2) + (inv_b * cos_t_2);
+
+    QVector3D xyz_coords = guiXyzToXyz(ellipse.pos.x(), ellipse.pos.y(), 0);
+    obs.c_x = xyz_coords.x();
+    obs.c_y = xyz_coords.y();
+}
+
+void SceneSnapshot::loadPlaneConstraint(TrajectoryProblem *P, quint32 index,
+                                        QVector3D xyz_p,
+                                        QVector3D xyz_q) const {
+    qreal c = ((xyz_q.x() * xyz_p.y()) - (xyz_q.y() * xyz_p.x()));
+
+    qreal a1 = (xyz_q.x() - xyz_p.x()) / c;
+    qreal a2 = (xyz_q.y() - xyz_p.y()) / c * -1.0;
+
+    QLineF line(QPointF(xyz_q.x(), xyz_q.y()),
+                QPointF(xyz_p.x(), xyz_p.y()));
+    QPointF normal = line.normalVector().p2();
+    qreal flip = ((a1 * normal.y()) + (a2 * normal.x()) < 1) ? -1 : 1;
+
+    HalfPlane &plane = P->planes[index];
+    plane.a[0] = flip * a1;
+    plane.a[1] = flip * a2;
+    plane.b = flip;
+}
+
+int SceneSnapshot::distributeWpEvenly(TrajectoryProblem *P,
+                                      int index, int remaining,
+                                      int low, int high) const {
+    // recursively fill waypoint indices with evenly spaced indicies
+    if (remaining != 0) {
+        int mid = (low + high + 1) / 2;
+
+        bool place = false;
+        if (remaining % 2 != 0) {
+            place = true;
+            remaining--;
+        }
+
+        index = distributeWpEvenly(P, index, remaining / 2, low, mid - 1);
+
+        if (place) {
+            assert(P->waypoints.at(index).index == 0);
+            P->waypoints[index].index = mid;
+            index++;
+        }
+
+        index = distributeWpEvenly(P, index, remaining / 2, mid, high);
+    }
+    return index;
+}
+
+bool SceneSnapshot::checkCachedSlot(
+        QVector<QPair<DataModel *, quint64>> *slots, int slot,
+        DataModel *item, quint64 generation) {
+    QPair<DataModel *, quint64> entry(item, generation);
+    if (slot < slots->size()) {
+        if (slots->at(slot) == entry) {
+            return true;
+        }
+        (*slots)[slot] = entry;
+    } else {
+        slots->append(entry);
+    }
+    return false;
+}
+
+}  // namespace optgui
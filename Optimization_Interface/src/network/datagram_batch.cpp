@@ -0,0 +1,95 @@
+// TITLE:   Optimization_Interface/src/network/datagram_batch.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/network/datagram_batch.h"
+
+#include <cstring>
+
+namespace optgui {
+
+qint32 const DatagramBatch::CAPACITY;
+qint64 const DatagramBatch::DATAGRAM_SIZE;
+
+DatagramBatch::DatagramBatch()
+    : buffer_(), sizes_(), dirty_() {
+}
+
+void DatagramBatch::allocate() {
+    // zero filled once, kept zeroed past each datagram after
+    this->buffer_.fill(0, CAPACITY * DATAGRAM_SIZE);
+    this->sizes_.fill(0, CAPACITY);
+    this->dirty_.fill(0, CAPACITY);
+
+#ifdef Q_OS_LINUX
+    // one slot per message, sender address not needed
+    this->iovecs_.resize(CAPACITY);
+    this->headers_.resize(CAPACITY);
+    for (qint32 i = 0; i < CAPACITY; i++) {
+        this->iovecs_[i].iov_base = this->getSlot(i);
+        this->iovecs_[i].iov_len = DATAGRAM_SIZE;
+        std::memset(&this->headers_[i], 0, sizeof(mmsghdr));
+        this->headers_[i].msg_hdr.msg_iov = &this->iovecs_[i];
+        this->headers_[i].msg_hdr.msg_iovlen = 1;
+    }
+#endif
+}
+
+char *DatagramBatch::getSlot(qint32 index) {
+    return this->buffer_.data() + index * DATAGRAM_SIZE;
+}
+
+char const *DatagramBatch::getData(qint32 index) const {
+    return this->buffer_.constData() + index * DATAGRAM_SIZE;
+}
+
+qint64 DatagramBatch::getSize(qint32 index) const {
+    return this->sizes_.at(index);
+}
+
+void DatagramBatch::setSize(qint32 index, qint64 size) {
+    size = qMax(size, qint64(0));
+    qint64 dirty = this->dirty_.at(index);
+    if (dirty > size) {
+        std::memset(this->getSlot(index) + size, 0, dirty - size);
+    }
+    this->sizes_[index] = size;
+    this->dirty_[index] = size;
+}
+
+qint32 DatagramBatch::receive(QUdpSocket *socket) {
+    if (this->buffer_.isEmpty()) {
+        this->allocate();
+    }
+
+    // read first datagram through socket so its read notifier
+    // is re-armed for the next readyRead
+    if (!socket->hasPendingDatagrams()) {
+        return 0;
+    }
+    this->setSize(0, socket->readDatagram(this->getSlot(0),
+                                          DATAGRAM_SIZE));
+    qint32 count = 1;
+
+#ifdef Q_OS_LINUX
+    // drain rest of batch in one syscall without blocking
+    int received = recvmmsg(static_cast<int>(socket->socketDescriptor()),
+                            this->headers_.data() + count,
+                            CAPACITY - count, MSG_DONTWAIT, nullptr);
+    for (qint32 i = 0; i < received; i++) {
+        this->setSize(count, this->headers_.at(count).msg_len);
+        count++;
+    }
+#else
+    while (count < CAPACITY && socket->hasPendingDatagrams()) {
+        this->setSize(count, socket->readDatagram(this->getSlot(count),
+                                                  DATAGRAM_SIZE));
+        count++;
+    }
+#endif
+
+    return count;
+}
+
+}  // namespace optgui
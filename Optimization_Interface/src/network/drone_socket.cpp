@@ -5,81 +5,83 @@
 
 #include "include/network/drone_socket.h"
 
+#include <QDateTime>
+
 #include "include/globals.h"
 
 namespace optgui {
 
 DroneSocket::DroneSocket(DroneGraphicsItem *model, QObject *parent)
-    : QUdpSocket(parent) {
+    : TelemetrySocket(parent), pending_telemetry_(),
+      destination_addr_(), tx_traj_() {
     this->drone_item_ = model;
-    this->bind(QHostAddress::AnyIPv4, this->drone_item_->model_->port_);
 
-    // automatically read incoming data with slots
-    connect(this, SIGNAL(readyRead()), this, SLOT(readPendingDatagrams()));
+    // resolve destination once, sockets are recreated when
+    // network configuration changes
+    this->destination_port_ = 0;
+    if (this->isDestinationAddrValid()) {
+        this->destination_addr_ =
+                QHostAddress(this->drone_item_->model_->ip_addr_);
+        this->destination_port_ =
+                this->drone_item_->model_->destination_port_;
+    }
 }
 
 DroneSocket::~DroneSocket() {
-    // close UDP socket
-    this->close();
 }
 
-void DroneSocket::readPendingDatagrams() {
-    while (this->hasPendingDatagrams()) {
-        // allocate buffer
-        char buffer[4000] = {0};
-        QHostAddress address;
-        quint16 port;
-        int64 bytes_read = this->readDatagram(buffer, 4000, &address, &port);
-
-        if (bytes_read > 0) {
-            // deserialize data into telemetry packet
-            autogen::deserializable::telemetry
-                  <autogen::topic::telemetry::UNDEFINED> telemetry_data;
-            // pointer is NULL if does not deserialize correctly
-            const uint8 *ptr_telemetry_data =
-                    telemetry_data.deserialize(
-                        reinterpret_cast<const uint8 *>(buffer));
-            if (ptr_telemetry_data != NULL) {
-                QVector3D gui_coords =
-                        nedToGuiXyz(telemetry_data.pos_ned(0),
-                                    telemetry_data.pos_ned(1),
-                                    telemetry_data.pos_ned(2));
-                QVector3D gui_vels =
-                        nedToGuiXyz(telemetry_data.vel_ned(0),
-                                    telemetry_data.vel_ned(1),
-                                    0);  // hard code velocity
-                QVector3D gui_accels =
-                        nedToGuiXyz(telemetry_data.accl_b(0),
-                                    telemetry_data.accl_b(1),
-                                    -9.81);  // hard code gravity
-                // set model telem
-                this->drone_item_->model_->setPos(gui_coords);
-                this->drone_item_->model_->setVel(gui_vels);
-                this->drone_item_->model_->setAccel(gui_accels);
-                // set graphics coords so view knows whether to paint it
-                this->drone_item_->setPos(QPointF(gui_coords.x(),
-                                                  gui_coords.y()));
-                emit refresh_graphics();
-            }
-        }
+bool DroneSocket::decodePacket(char const *buffer, qint64 size) {
+    // telemetry deserializer reads its own length
+    Q_UNUSED(size);
+
+    // deserialize data into telemetry packet
+    autogen::deserializable::telemetry
+          <autogen::topic::telemetry::UNDEFINED> telemetry_data;
+    // pointer is NULL if does not deserialize correctly
+    const uint8 *ptr_telemetry_data =
+            telemetry_data.deserialize(
+                reinterpret_cast<const uint8 *>(buffer));
+    if (ptr_telemetry_data == NULL) {
+        return false;
     }
+
+    QVector3D gui_coords =
+            nedToGuiXyz(telemetry_data.pos_ned(0),
+                        telemetry_data.pos_ned(1),
+                        telemetry_data.pos_ned(2));
+    QVector3D gui_vels =
+            nedToGuiXyz(telemetry_data.vel_ned(0),
+                        telemetry_data.vel_ned(1),
+                        0);  // hard code velocity
+    QVector3D gui_accels =
+            nedToGuiXyz(telemetry_data.accl_b(0),
+                        telemetry_data.accl_b(1),
+                        -9.81);  // hard code gravity
+    // stamped with receive time
+    this->pending_telemetry_.pos = gui_coords;
+    this->pending_telemetry_.vel = gui_vels;
+    this->pending_telemetry_.accel = gui_accels;
+    this->pending_telemetry_.timestamp = QDateTime::currentMSecsSinceEpoch();
+    return true;
 }
 
-void DroneSocket::rx_trajectory(DroneModelItem *drone,
-                                const autogen::packet::traj3dof data) {
-    if (drone == this->drone_item_->model_) {
-        autogen::serializable::traj3dof
-                <autogen::topic::traj3dof::UNDEFINED> ser_data;
-        ser_data = data;
-        char buffer[4096] = {0};
-        ser_data.serialize(reinterpret_cast<uint8 *>(buffer));
-
-        if (this->isDestinationAddrValid()) {
-            this->writeDatagram(buffer, ser_data.size(),
-                    QHostAddress(this->drone_item_->model_->ip_addr_),
-                    this->drone_item_->model_->destination_port_);
-        }
+bool DroneSocket::applyPacket() {
+    // set model telem from packet in one write,
+    // skip re-render if telemetry did not change
+    return this->drone_item_->model_->setTelemetry(this->pending_telemetry_);
+}
+
+void DroneSocket::rx_trajectory(DroneModelItem *drone, Traj3dofPtr data) {
+    if (drone != this->drone_item_->model_ ||
+            this->destination_addr_.isNull()) {
+        return;
     }
+
+    // serialize into reused buffer, only serialized bytes are sent
+    this->tx_traj_ = *data;
+    this->tx_traj_.serialize(reinterpret_cast<uint8 *>(this->tx_buffer_));
+    this->writeDatagram(this->tx_buffer_, this->tx_traj_.size(),
+                        this->destination_addr_, this->destination_port_);
 }
 
 bool DroneSocket::isDestinationAddrValid() {
@@ -10,51 +10,41 @@
 namespace optgui {
 
 EllipseSocket::EllipseSocket(EllipseGraphicsItem *item, QObject *parent)
-    : QUdpSocket(parent) {
+    : TelemetrySocket(parent), pending_pos_() {
     this->ellipse_item_ = item;
-    this->bind(QHostAddress::AnyIPv4, this->ellipse_item_->model_->port_);
-
-    // automatically read incoming data with slots
-    connect(this, SIGNAL(readyRead()), this, SLOT(readPendingDatagrams()));
 }
 
 EllipseSocket::~EllipseSocket() {
-    // close UDP socket
-    this->close();
 }
 
-void EllipseSocket::readPendingDatagrams() {
-    while (this->hasPendingDatagrams()) {
-        // create empty buffer
-        char buffer[4000] = {0};
-        QHostAddress address;
-        quint16 port;
-        int64 bytes_read = this->readDatagram(buffer, 4000, &address, &port);
-
-        if (bytes_read > 0) {
-            // deserialize telemetry
-            autogen::deserializable::telemetry
-                  <autogen::topic::telemetry::UNDEFINED> telemetry_data;
-            // pointer is NULL if does not deserialize correctly
-            const uint8 *ptr_telemetry_data =
-                    telemetry_data.deserialize(
-                        reinterpret_cast<const uint8 *>(buffer));
-            if (ptr_telemetry_data != NULL) {
-                QVector3D gui_coords_3D =
-                        nedToGuiXyz(telemetry_data.pos_ned(0),
-                                    telemetry_data.pos_ned(1),
-                                    telemetry_data.pos_ned(2));
-                QPointF gui_coords_2D = QPointF(gui_coords_3D.x(),
-                                                gui_coords_3D.y());
-
-                // set model pos
-                this->ellipse_item_->model_->setPos(gui_coords_2D);
-                // set graphics pos so view knows whether to paint it
-                this->ellipse_item_->setPos(gui_coords_2D);
-                emit refresh_graphics();
-            }
-        }
+bool EllipseSocket::decodePacket(char const *buffer, qint64 size) {
+    // telemetry deserializer reads its own length
+    Q_UNUSED(size);
+
+    // deserialize telemetry
+    autogen::deserializable::telemetry
+          <autogen::topic::telemetry::UNDEFINED> telemetry_data;
+    // pointer is NULL if does not deserialize correctly
+    const uint8 *ptr_telemetry_data =
+            telemetry_data.deserialize(
+                reinterpret_cast<const uint8 *>(buffer));
+    if (ptr_telemetry_data == NULL) {
+        return false;
     }
+
+    QVector3D gui_coords_3D =
+            nedToGuiXyz(telemetry_data.pos_ned(0),
+                        telemetry_data.pos_ned(1),
+                        telemetry_data.pos_ned(2));
+    this->pending_pos_ = QPointF(gui_coords_3D.x(), gui_coords_3D.y());
+    return true;
+}
+
+bool EllipseSocket::applyPacket() {
+    // set model pos, skip re-render if not moved
+    quint64 generation = this->ellipse_item_->model_->getGeneration();
+    this->ellipse_item_->model_->setPos(this->pending_pos_);
+    return generation != this->ellipse_item_->model_->getGeneration();
 }
 
 }  // namespace optgui
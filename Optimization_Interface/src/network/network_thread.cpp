@@ -0,0 +1,51 @@
+// TITLE:   Optimization_Interface/src/network/network_thread.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/network/network_thread.h"
+
+namespace optgui {
+
+void NetworkWorker::bindSocket(QUdpSocket *socket, quint16 port) {
+    // socket notifier created on this thread,
+    // port 0 leaves socket unbound for decoding routed packets
+    if (port > 0) {
+        socket->bind(QHostAddress::AnyIPv4, port);
+    }
+}
+
+void NetworkWorker::deleteSocket(QUdpSocket *socket) {
+    delete socket;
+}
+
+NetworkThread::NetworkThread(QObject *parent)
+    : QThread(parent) {
+    this->worker_ = new NetworkWorker();
+    this->worker_->moveToThread(this);
+    // default run executes event loop for socket notifiers
+    this->start();
+}
+
+NetworkThread::~NetworkThread() {
+    this->quit();
+    this->wait();
+    // safe to delete once thread has finished
+    delete this->worker_;
+}
+
+void NetworkThread::addSocket(QUdpSocket *socket, quint16 port) {
+    socket->moveToThread(this);
+    QMetaObject::invokeMethod(this->worker_, "bindSocket",
+                              Qt::BlockingQueuedConnection,
+                              Q_ARG(QUdpSocket *, socket),
+                              Q_ARG(quint16, port));
+}
+
+void NetworkThread::removeSocket(QUdpSocket *socket) {
+    QMetaObject::invokeMethod(this->worker_, "deleteSocket",
+                              Qt::BlockingQueuedConnection,
+                              Q_ARG(QUdpSocket *, socket));
+}
+
+}  // namespace optgui
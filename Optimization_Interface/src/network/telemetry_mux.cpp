@@ -0,0 +1,95 @@
+// TITLE:   Optimization_Interface/src/network/telemetry_mux.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/network/telemetry_mux.h"
+
+#include <QtEndian>
+#include <QVarLengthArray>
+
+namespace optgui {
+
+// bytes of object id and sequence number before telemetry packet
+static qint64 const MUX_HEADER_SIZE = sizeof(quint16) + sizeof(quint32);
+
+TelemetryMux::TelemetryMux(QObject *parent)
+    : QUdpSocket(parent), mutex_(), routes_(), batch_() {
+    // automatically read incoming data with slots
+    connect(this, SIGNAL(readyRead()), this, SLOT(readPendingDatagrams()));
+}
+
+TelemetryMux::~TelemetryMux() {
+    // close UDP socket
+    this->close();
+}
+
+void TelemetryMux::addRoute(quint16 id, TelemetrySocket *socket) {
+    QMutexLocker locker(&this->mutex_);
+    this->routes_.insert(id, socket);
+}
+
+void TelemetryMux::removeRoute(TelemetrySocket *socket) {
+    QMutexLocker locker(&this->mutex_);
+    QMutableHashIterator<quint16, TelemetrySocket *> it(this->routes_);
+    while (it.hasNext()) {
+        if (it.next().value() == socket) {
+            it.remove();
+        }
+    }
+}
+
+void TelemetryMux::readPendingDatagrams() {
+    bool changed = false;
+    qint32 count = 0;
+    do {
+        count = this->batch_.receive(this);
+        if (this->routeBatch(count)) {
+            changed = true;
+        }
+    } while (count == DatagramBatch::CAPACITY);
+
+    // move graphics on next render frame
+    if (changed) {
+        emit refresh_graphics();
+    }
+}
+
+bool TelemetryMux::routeBatch(qint32 count) {
+    // objects offered packets in batch
+    QVarLengthArray<TelemetrySocket *, DatagramBatch::CAPACITY> offered;
+
+    // hold lock while decoding so routed sockets are not deleted
+    QMutexLocker locker(&this->mutex_);
+    for (qint32 i = count - 1; i >= 0; i--) {
+        qint64 size = this->batch_.getSize(i);
+        if (size <= MUX_HEADER_SIZE) {
+            continue;
+        }
+        uchar const *header =
+                reinterpret_cast<uchar const *>(this->batch_.getData(i));
+        quint16 id = qFromBigEndian<quint16>(header);
+        quint32 sequence = qFromBigEndian<quint32>(header + sizeof(quint16));
+        // drop packets for unknown objects
+        TelemetrySocket *socket = this->routes_.value(id, nullptr);
+        if (!socket) {
+            continue;
+        }
+        socket->offerPacket(this->batch_.getData(i) + MUX_HEADER_SIZE,
+                            size - MUX_HEADER_SIZE, true, sequence);
+        if (!offered.contains(socket)) {
+            offered.append(socket);
+        }
+    }
+
+    // freshest sample of each object written once
+    bool changed = false;
+    for (TelemetrySocket *socket : offered) {
+        if (socket->applyPending()) {
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+}  // namespace optgui
@@ -0,0 +1,164 @@
+// TITLE:   Optimization_Interface/src/network/telemetry_socket.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/network/telemetry_socket.h"
+
+namespace optgui {
+
+// gain of jitter filter, as in RTP interarrival jitter
+static qreal const JITTER_GAIN = 1.0 / 16.0;
+// packets at most this far behind applied sample are reordered,
+// further behind the sender restarted its numbering
+static quint32 const SEQUENCE_REORDER_WINDOW = 64;
+
+TelemetrySocket::TelemetrySocket(QObject *parent)
+    : QUdpSocket(parent), batch_(), mutex_(), stats_() {
+    this->has_pending_ = false;
+    this->pending_has_sequence_ = false;
+    this->pending_sequence_ = 0;
+    this->pending_received_ = 0;
+    this->has_applied_sequence_ = false;
+    this->applied_sequence_ = 0;
+
+    this->clock_.start();
+    this->last_arrival_nsecs_ = -1;
+    this->last_interval_nsecs_ = -1;
+
+    // automatically read incoming data with slots
+    connect(this, SIGNAL(readyRead()), this, SLOT(readPendingDatagrams()));
+}
+
+TelemetrySocket::~TelemetrySocket() {
+    // close UDP socket
+    this->close();
+}
+
+bool TelemetrySocket::isNewer(quint32 sequence, quint32 than) {
+    return static_cast<qint32>(sequence - than) > 0;
+}
+
+void TelemetrySocket::offerPacket(char const *buffer, qint64 size,
+                                  bool has_sequence, quint32 sequence) {
+    QMutexLocker locker(&this->mutex_);
+    this->stats_.received++;
+
+    if (has_sequence) {
+        if (this->has_applied_sequence_ &&
+                !isNewer(sequence, this->applied_sequence_)) {
+            // drop packets reordered behind or repeating applied sample
+            if (this->applied_sequence_ - sequence <=
+                    SEQUENCE_REORDER_WINDOW) {
+                this->stats_.stale++;
+                return;
+            }
+            // sender restarted, take its numbering from here without
+            // counting the jump as lost. pending sample is from
+            // before the restart
+            this->stats_.resyncs++;
+            this->has_applied_sequence_ = false;
+            this->has_pending_ = false;
+            this->pending_received_ = 0;
+        }
+        if (this->has_pending_ && this->pending_has_sequence_ &&
+                sequence == this->pending_sequence_) {
+            this->stats_.stale++;
+            return;
+        }
+        this->pending_received_++;
+    }
+
+    // batch read newest first, so without sequence numbers
+    // any pending sample arrived after this one
+    if (this->has_pending_ && !(has_sequence &&
+            this->pending_has_sequence_ &&
+            isNewer(sequence, this->pending_sequence_))) {
+        this->stats_.superseded++;
+        return;
+    }
+
+    if (!this->decodePacket(buffer, size)) {
+        this->stats_.malformed++;
+        return;
+    }
+    if (this->has_pending_) {
+        // replaced sample arrived later but is older
+        this->stats_.superseded++;
+    }
+    this->has_pending_ = true;
+    this->pending_has_sequence_ = has_sequence;
+    this->pending_sequence_ = sequence;
+}
+
+bool TelemetrySocket::applyPending() {
+    QMutexLocker locker(&this->mutex_);
+    quint64 received = this->pending_received_;
+    this->pending_received_ = 0;
+    if (!this->has_pending_) {
+        return false;
+    }
+    this->has_pending_ = false;
+
+    if (this->pending_has_sequence_) {
+        // numbers skipped since last applied sample
+        // that were not offered in this batch
+        if (this->has_applied_sequence_) {
+            quint64 skipped =
+                    this->pending_sequence_ - this->applied_sequence_;
+            if (skipped > received) {
+                this->stats_.lost += skipped - received;
+            }
+        }
+        this->has_applied_sequence_ = true;
+        this->applied_sequence_ = this->pending_sequence_;
+    }
+
+    // smooth change in interval between applied samples
+    qint64 arrival = this->clock_.nsecsElapsed();
+    if (this->last_arrival_nsecs_ >= 0) {
+        qint64 interval = arrival - this->last_arrival_nsecs_;
+        if (this->last_interval_nsecs_ >= 0) {
+            qreal deviation = qAbs(interval - this->last_interval_nsecs_)
+                    / 1e6;
+            this->stats_.jitter_msecs += JITTER_GAIN *
+                    (deviation - this->stats_.jitter_msecs);
+        }
+        this->last_interval_nsecs_ = interval;
+    }
+    this->last_arrival_nsecs_ = arrival;
+
+    this->stats_.applied++;
+    return this->applyPacket();
+}
+
+TelemetryStats TelemetrySocket::getTelemetryStats() {
+    QMutexLocker locker(&this->mutex_);
+    return this->stats_;
+}
+
+void TelemetrySocket::readPendingDatagrams() {
+    bool changed = false;
+    qint32 count = 0;
+    do {
+        count = this->batch_.receive(this);
+        // newest first, older packets only decoded if newer ones
+        // do not deserialize
+        for (qint32 i = count - 1; i >= 0; i--) {
+            if (this->batch_.getSize(i) > 0) {
+                this->offerPacket(this->batch_.getData(i),
+                                  this->batch_.getSize(i), false, 0);
+            }
+        }
+        if (this->applyPending()) {
+            changed = true;
+        }
+    } while (count == DatagramBatch::CAPACITY);
+
+    // move graphic on next render frame
+    if (changed) {
+        emit refresh_graphics();
+    }
+}
+
+}  // namespace optgui
@@ -0,0 +1,377 @@
+// TITLE:   Optimization_Interface/src/solvers/reference_solver.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/solvers/reference_solver.h"
+
+#include <QtMath>
+
+namespace optgui {
+
+// iterations for matching peak acceleration with free final time
+static quint32 const FREE_FINAL_TIME_ITERATIONS = 8;
+// stop matching once final time changes by less than this fraction
+static double const FREE_FINAL_TIME_TOLERANCE = 0.01;
+// knots added or moved to clear constraints per pass
+static quint32 const MAX_AVOID_ITERATIONS = 50;
+// alternating projections onto obstacles and planes per knot,
+// more than one so clearing one constraint can undo another less
+static quint32 const PROJECTION_PASSES = 4;
+// clearance past obstacle radius, as fraction of radius
+static double const OBSTACLE_MARGIN = 0.02;
+// clearance past planes in meters
+static double const PLANE_MARGIN = 0.05;
+// smallest knot move in meters still counted as progress
+static double const KNOT_TOLERANCE = 1e-4;
+
+ReferenceSolver::ReferenceSolver() : outputs_() {
+    this->K_ = 0;
+    this->tf_ = 0;
+    this->seed_tf_ = 0;
+    this->a_max_ = 0;
+    this->v_max_ = 0;
+}
+
+void ReferenceSolver::setProblem(TrajectoryProblem const &problem,
+                                 TrajectoryInputs const &inputs) {
+    // initial acceleration is free in a double integrator
+    this->K_ = qMax(problem.K, quint32(2));
+    this->tf_ = problem.tf;
+    this->a_max_ = problem.a_max;
+    this->v_max_ = problem.v_max;
+
+    // copy ellipse obstacles
+    int num_obs = problem.obstacles.size();
+    this->obs_center_.resize(num_obs);
+    this->obs_matrix_.resize(num_obs);
+    this->obs_radius_.resize(num_obs);
+    for (int i = 0; i < num_obs; i++) {
+        EllipseObstacle const &obs = problem.obstacles.at(i);
+        this->obs_center_[i] = QVector3D(obs.c_x, obs.c_y, 0);
+        this->obs_matrix_[i] = { obs.M[0][0], obs.M[0][1],
+                                 obs.M[1][0], obs.M[1][1] };
+        this->obs_radius_[i] = obs.R;
+    }
+    this->planes_ = problem.planes;
+
+    // pass through waypoints at their assigned points in traj
+    this->fixed_.fill(false, this->K_);
+    this->fixed_[0] = true;
+    this->fixed_[this->K_ - 1] = true;
+    this->base_knots_.clear();
+    this->base_fractions_.clear();
+    this->base_knots_.append(QVector3D(inputs.r_i[0], inputs.r_i[1],
+                                       inputs.r_i[2]));
+    this->base_fractions_.append(0);
+    for (TrajectoryWaypoint const &wp : problem.waypoints) {
+        quint32 index = qMin(wp.index, this->K_ - 1);
+        this->fixed_[index] = true;
+        this->base_knots_.append(QVector3D(wp.r[0], wp.r[1], wp.r[2]));
+        this->base_fractions_.append(qreal(index) / (this->K_ - 1));
+    }
+    this->base_knots_.append(QVector3D(inputs.r_f[0], inputs.r_f[1],
+                                       inputs.r_f[2]));
+    this->base_fractions_.append(1);
+    this->v_i_ = QVector3D(inputs.v_i[0], inputs.v_i[1], inputs.v_i[2]);
+}
+
+void ReferenceSolver::resetInputs() {
+    // path is closed form, only the final time guess is seeded
+    this->seed_tf_ = 0;
+}
+
+void ReferenceSolver::setInitialGuess(TrajectorySeed const &seed) {
+    // time left on previous traj is close to the final time
+    // of the new one, ignore seeds with no time left
+    this->seed_tf_ = seed.t.isEmpty() ? 0 : qMax(seed.t.last(), 0.0);
+}
+
+TrajectoryOutputs const &ReferenceSolver::solve(bool free_final_time) {
+    // free final time starts from seed when given
+    if (free_final_time && this->seed_tf_ > 0) {
+        this->tf_ = this->seed_tf_;
+    }
+    this->seed_tf_ = 0;
+
+    // start from boundary conditions and waypoints only,
+    // pinned traj points never get knots added
+    this->knots_ = this->base_knots_;
+    this->knot_fractions_ = this->base_fractions_;
+    this->skip_ = this->fixed_;
+
+    double peak_accel = this->sample(this->tf_);
+    this->outputs_.iterations = 1;
+    peak_accel = this->avoidConstraints(peak_accel);
+
+    // scale final time until peak acceleration reaches limit,
+    // acceleration scales with inverse square of time
+    if (free_final_time && this->a_max_ > 0) {
+        for (quint32 i = 0; i < FREE_FINAL_TIME_ITERATIONS; i++) {
+            if (peak_accel <= 0) {
+                break;
+            }
+            double scale = qSqrt(peak_accel / this->a_max_);
+            if (qAbs(scale - 1) < FREE_FINAL_TIME_TOLERANCE) {
+                break;
+            }
+            this->tf_ *= scale;
+            peak_accel = this->sample(this->tf_);
+            this->outputs_.iterations++;
+        }
+        // knots keep their fraction of final time, but velocity
+        // at initial pos bends first segment differently
+        this->avoidConstraints(peak_accel);
+    }
+
+    this->outputs_.violation = this->scoreViolation();
+    return this->outputs_;
+}
+
+double ReferenceSolver::sample(double tf) {
+    // knot times and velocities, stopping at final pos
+    int n = this->knots_.size();
+    QVector<double> times(n);
+    QVector<QVector3D> vels(n);
+    for (int i = 0; i < n; i++) {
+        times[i] = this->knot_fractions_.at(i) * tf;
+    }
+    vels[0] = this->v_i_;
+    vels[n - 1] = QVector3D(0, 0, 0);
+    for (int i = 1; i < n - 1; i++) {
+        double dt = times.at(i + 1) - times.at(i - 1);
+        vels[i] = dt > 0 ?
+                (this->knots_.at(i + 1) - this->knots_.at(i - 1)) / dt :
+                QVector3D(0, 0, 0);
+    }
+
+    this->outputs_.t.resize(this->K_);
+    this->outputs_.r.resize(this->K_);
+    this->outputs_.v.resize(this->K_);
+    this->outputs_.a.resize(this->K_);
+
+    double peak_accel = 0;
+    int segment = 0;
+    for (quint32 k = 0; k < this->K_; k++) {
+        double t = tf * k / (this->K_ - 1);
+        while (segment < n - 2 && t > times.at(segment + 1)) {
+            segment++;
+        }
+
+        // cubic hermite segment, minimum acceleration between
+        // its end positions and velocities
+        double h = times.at(segment + 1) - times.at(segment);
+        double s = h > 0 ? (t - times.at(segment)) / h : 0;
+        QVector3D p0 = this->knots_.at(segment);
+        QVector3D p1 = this->knots_.at(segment + 1);
+        QVector3D m0 = h * vels.at(segment);
+        QVector3D m1 = h * vels.at(segment + 1);
+        double s2 = s * s;
+        double s3 = s2 * s;
+
+        QVector3D r = (2 * s3 - 3 * s2 + 1) * p0 + (s3 - 2 * s2 + s) * m0
+                + (-2 * s3 + 3 * s2) * p1 + (s3 - s2) * m1;
+        QVector3D v;
+        QVector3D a;
+        if (h > 0) {
+            v = ((6 * s2 - 6 * s) * p0 + (3 * s2 - 4 * s + 1) * m0
+                 + (-6 * s2 + 6 * s) * p1 + (3 * s2 - 2 * s) * m1) / h;
+            a = ((12 * s - 6) * p0 + (6 * s - 4) * m0
+                 + (-12 * s + 6) * p1 + (6 * s - 2) * m1) / (h * h);
+        }
+        peak_accel = qMax(peak_accel, double(a.length()));
+
+        this->outputs_.t[k] = t;
+        this->outputs_.r[k] = r;
+        this->outputs_.v[k] = v;
+        // counteract gravity like drone telemetry
+        this->outputs_.a[k] = a + QVector3D(0, 0, 9.81);
+    }
+    return peak_accel;
+}
+
+double ReferenceSolver::avoidConstraints(double peak_accel) {
+    for (quint32 i = 0; i < MAX_AVOID_ITERATIONS; i++) {
+        if (!this->addAvoidanceKnot()) {
+            break;
+        }
+        peak_accel = this->sample(this->tf_);
+        this->outputs_.iterations++;
+    }
+    return peak_accel;
+}
+
+bool ReferenceSolver::addAvoidanceKnot() {
+    // fractions of traj points are half a step apart from
+    // fractions of neighboring points
+    double half_step = 0.5 / (this->K_ - 1);
+    while (true) {
+        // deepest traj point in constraints that can still move
+        int worst = -1;
+        double worst_depth = 0;
+        for (quint32 k = 0; k < this->K_; k++) {
+            if (this->skip_.at(k)) {
+                continue;
+            }
+            QVector3D r = this->outputs_.r.at(k);
+            double depth = 0;
+            for (int i = 0; i < this->obs_center_.size(); i++) {
+                depth = qMax(depth, this->obstacleDepth(i, r));
+            }
+            for (int i = 0; i < this->planes_.size(); i++) {
+                depth = qMax(depth, this->planeDepth(i, r));
+            }
+            if (depth > worst_depth) {
+                worst = k;
+                worst_depth = depth;
+            }
+        }
+        if (worst < 0) {
+            return false;
+        }
+
+        // pin traj point outside constraints with a knot
+        QVector3D cleared = this->project(this->outputs_.r.at(worst));
+        double fraction = qreal(worst) / (this->K_ - 1);
+        int index = 0;
+        while (index < this->knot_fractions_.size() &&
+               this->knot_fractions_.at(index) < fraction - half_step) {
+            index++;
+        }
+        if (index < this->knot_fractions_.size() &&
+                this->knot_fractions_.at(index) < fraction + half_step) {
+            // knot added earlier, constraints conflict
+            // if projecting does not move it
+            if ((this->knots_.at(index) - cleared).length() <
+                    KNOT_TOLERANCE) {
+                this->skip_[worst] = true;
+                continue;
+            }
+            this->knots_[index] = cleared;
+        } else {
+            this->knots_.insert(index, cleared);
+            this->knot_fractions_.insert(index, fraction);
+        }
+        return true;
+    }
+}
+
+QVector3D ReferenceSolver::project(QVector3D r) const {
+    for (quint32 pass = 0; pass < PROJECTION_PASSES; pass++) {
+        // push out of ellipse along ray from its center
+        for (int i = 0; i < this->obs_center_.size(); i++) {
+            double radius = this->obs_radius_.at(i);
+            if (this->obstacleDepth(i, r) <= 0) {
+                continue;
+            }
+            QVector<double> const &M = this->obs_matrix_.at(i);
+            double det = M.at(0) * M.at(3) - M.at(1) * M.at(2);
+            if (qFuzzyIsNull(det)) {
+                continue;
+            }
+            QVector3D d = r - this->obs_center_.at(i);
+            double x = M.at(0) * d.x() + M.at(1) * d.y();
+            double y = M.at(2) * d.x() + M.at(3) * d.y();
+            double length = qSqrt(x * x + y * y);
+            double target = radius * (1 + OBSTACLE_MARGIN);
+            if (length > 0) {
+                x *= target / length;
+                y *= target / length;
+            } else {
+                x = target;
+                y = 0;
+            }
+            // back to xyz with inverse of M, go out the far side
+            // instead if near side is past a plane
+            QVector3D offset((M.at(3) * x - M.at(1) * y) / det,
+                             (M.at(0) * y - M.at(2) * x) / det, 0);
+            QVector3D near_side = r - d + offset;
+            QVector3D far_side = r - d - offset;
+            r = (this->clearsPlanes(near_side) ||
+                 !this->clearsPlanes(far_side)) ? near_side : far_side;
+        }
+
+        // move along plane normal to feasible side
+        for (int i = 0; i < this->planes_.size(); i++) {
+            double depth = this->planeDepth(i, r);
+            if (depth <= 0) {
+                continue;
+            }
+            HalfPlane const &plane = this->planes_.at(i);
+            double norm = qSqrt(plane.a[0] * plane.a[0] +
+                                plane.a[1] * plane.a[1]);
+            double step = (depth + PLANE_MARGIN) / norm;
+            r.setX(r.x() + step * plane.a[1]);
+            r.setY(r.y() + step * plane.a[0]);
+        }
+    }
+    return r;
+}
+
+double ReferenceSolver::obstacleDepth(int i, QVector3D const &r) const {
+    QVector3D d = r - this->obs_center_.at(i);
+    QVector<double> const &M = this->obs_matrix_.at(i);
+    double x = M.at(0) * d.x() + M.at(1) * d.y();
+    double y = M.at(2) * d.x() + M.at(3) * d.y();
+    return this->obs_radius_.at(i) - qSqrt(x * x + y * y);
+}
+
+bool ReferenceSolver::clearsPlanes(QVector3D const &r) const {
+    for (int i = 0; i < this->planes_.size(); i++) {
+        if (this->planeDepth(i, r) > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+double ReferenceSolver::planeDepth(int i, QVector3D const &r) const {
+    // plane line passes through polygon edge or plane end points
+    // with a[0] on y, see SceneSnapshot::loadPlaneConstraint
+    HalfPlane const &plane = this->planes_.at(i);
+    double norm = qSqrt(plane.a[0] * plane.a[0] + plane.a[1] * plane.a[1]);
+    if (norm <= 0) {
+        return 0;
+    }
+    return (plane.b - plane.a[0] * r.y() - plane.a[1] * r.x()) / norm;
+}
+
+double ReferenceSolver::scoreViolation() {
+    double violation = 0;
+    for (quint32 k = 0; k < this->K_; k++) {
+        QVector3D r = this->outputs_.r.at(k);
+
+        // depth inside ellipse obstacles and past planes
+        for (int i = 0; i < this->obs_center_.size(); i++) {
+            double inside = this->obstacleDepth(i, r);
+            if (inside > 0) {
+                violation += inside * inside;
+            }
+        }
+        for (int i = 0; i < this->planes_.size(); i++) {
+            double past = this->planeDepth(i, r);
+            if (past > 0) {
+                violation += past * past;
+            }
+        }
+
+        // speed and acceleration over limits, relative to limits
+        if (this->v_max_ > 0) {
+            double over = (this->outputs_.v.at(k).length() - this->v_max_)
+                    / this->v_max_;
+            if (over > 0) {
+                violation += over * over;
+            }
+        }
+        if (this->a_max_ > 0) {
+            QVector3D a = this->outputs_.a.at(k) - QVector3D(0, 0, 9.81);
+            double over = (a.length() - this->a_max_) / this->a_max_;
+            if (over > 0) {
+                violation += over * over;
+            }
+        }
+    }
+    return violation;
+}
+
+}  // namespace optgui
@@ -0,0 +1,147 @@
+// TITLE:   Optimization_Interface/src/solvers/skyefly_solver.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/solvers/skyefly_solver.h"
+
+#include <QtMath>
+
+namespace optgui {
+
+SkyeFlySolver::SkyeFlySolver() : fly_(), P_(), inputs_(), wp_(),
+    outputs_() {
+    this->K_ = 0;
+}
+
+void SkyeFlySolver::setProblem(TrajectoryProblem const &problem,
+                               TrajectoryInputs const &inputs) {
+    skyenet::params &P = this->P_;
+    P.K = problem.K;
+    P.tf = problem.tf;
+    P.a_min = problem.a_min;
+    P.a_max = problem.a_max;
+    P.v_max = problem.v_max;
+    P.v_max_slow = problem.v_max_slow;
+    P.theta_max = problem.theta_max;
+    P.j_max = problem.j_max;
+    P.delta = problem.delta;
+    P.max_iter = problem.max_iter;
+    P.lambda = problem.lambda;
+    P.ri_relax = problem.ri_relax;
+    P.rf_relax = problem.rf_relax;
+    P.wp_relax = problem.wp_relax;
+    P.trust_tau_weight = problem.trust_tau_weight;
+    P.trust_delta_weight = problem.trust_delta_weight;
+
+    // ellipse obstacles
+    P.obs.n = qMin(quint32(problem.obstacles.size()),
+                   quint32(skyenet::MAX_OBS));
+    for (quint32 i = 0; i < P.obs.n; i++) {
+        EllipseObstacle const &obs = problem.obstacles.at(i);
+        P.obs.c_x[i] = obs.c_x;
+        P.obs.c_y[i] = obs.c_y;
+        P.obs.M0[0][i] = obs.M[0][0];
+        P.obs.M0[1][i] = obs.M[0][1];
+        P.obs.M1[0][i] = obs.M[1][0];
+        P.obs.M1[1][i] = obs.M[1][1];
+        P.obs.R[i] = obs.R;
+    }
+
+    // half plane position constraints
+    P.cpos.n = qMin(quint32(problem.planes.size()),
+                    quint32(skyenet::MAX_CPOS));
+    for (quint32 i = 0; i < P.cpos.n; i++) {
+        HalfPlane const &plane = problem.planes.at(i);
+        P.cpos.A[2 * i] = plane.a[0];
+        P.cpos.A[(2 * i) + 1] = plane.a[1];
+        P.cpos.b[i] = plane.b;
+    }
+
+    // waypoints, unused slots zeroed
+    P.n_wp = qMin(quint32(problem.waypoints.size()),
+                  quint32(skyenet::MAX_WAYPOINTS));
+    for (quint32 i = 0; i < skyenet::MAX_WAYPOINTS; i++) {
+        TrajectoryWaypoint wp = {};
+        if (i < P.n_wp) {
+            wp = problem.waypoints.at(i);
+        }
+        P.wp_idx[i] = wp.index;
+        this->wp_[i][0] = wp.r[0];
+        this->wp_[i][1] = wp.r[1];
+        this->wp_[i][2] = wp.r[2];
+    }
+    // no waypoints, dont factor in relaxation
+    if (P.n_wp == 0) {
+        P.wp_relax = 0;
+    }
+
+    this->K_ = P.K;
+
+    // keep copy of boundary conditions for resetting inputs
+    this->inputs_ = inputs;
+    this->fly_.setParams(P, this->inputs_.r_i, this->inputs_.v_i,
+                         this->inputs_.a_i, this->inputs_.r_f,
+                         this->wp_);
+}
+
+void SkyeFlySolver::resetInputs() {
+    this->fly_.resetInputs(this->inputs_.r_i, this->inputs_.v_i,
+                           this->inputs_.a_i, this->inputs_.r_f,
+                           this->wp_);
+}
+
+TrajectoryOutputs const &SkyeFlySolver::solve(bool free_final_time) {
+    // Run SCvx algorithm for free or fixed final time
+    skyenet::outputs const &O = this->fly_.update(free_final_time);
+
+    quint32 size = this->K_;
+    this->outputs_.t.resize(size);
+    this->outputs_.r.resize(size);
+    this->outputs_.v.resize(size);
+    this->outputs_.a.resize(size);
+    for (quint32 i = 0; i < size; i++) {
+        this->outputs_.t[i] = O.t[i];
+        this->outputs_.r[i] = QVector3D(O.r[0][i], O.r[1][i], O.r[2][i]);
+        this->outputs_.v[i] = QVector3D(O.v[0][i], O.v[1][i], O.v[2][i]);
+        this->outputs_.a[i] = QVector3D(O.a[0][i], O.a[1][i], O.a[2][i]);
+    }
+
+    // OUTPUT VIOLATIONS: initial and final pos violation
+    this->outputs_.violation = qPow(O.rf_relax[0], 2)  // final pos
+                             + qPow(O.rf_relax[1], 2)
+                             + qPow(O.rf_relax[2], 2)
+
+                             + qPow(O.ri_relax[0], 2)  // initial pos
+                             + qPow(O.ri_relax[1], 2)
+                             + qPow(O.ri_relax[2], 2)
+
+                             + qPow(O.dtau, 2);  // change in time
+
+    // skyenet outputs do not report SCvx iterations
+    this->outputs_.iterations = 0;
+
+    return this->outputs_;
+}
+
+void SkyeFlySolver::loadDefaults(TrajectoryProblem *problem) {
+    skyenet::params P;
+    problem->K = P.K;
+    problem->tf = P.tf;
+    problem->a_min = P.a_min;
+    problem->a_max = P.a_max;
+    problem->v_max = P.v_max;
+    problem->v_max_slow = P.v_max_slow;
+    problem->theta_max = P.theta_max;
+    problem->j_max = P.j_max;
+    problem->delta = P.delta;
+    problem->max_iter = P.max_iter;
+    problem->lambda = P.lambda;
+    problem->ri_relax = P.ri_relax;
+    problem->rf_relax = P.rf_relax;
+    problem->wp_relax = P.wp_relax;
+    problem->trust_tau_weight = P.trust_tau_weight;
+    problem->trust_delta_weight = P.trust_delta_weight;
+}
+
+}  // namespace optgui
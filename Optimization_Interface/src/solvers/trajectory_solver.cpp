@@ -0,0 +1,104 @@
+// TITLE:   Optimization_Interface/src/solvers/trajectory_solver.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/solvers/trajectory_solver.h"
+
+#ifndef REFERENCE_SOLVER_ONLY
+#include "include/solvers/skyefly_solver.h"
+#endif
+#include "include/solvers/reference_solver.h"
+
+namespace optgui {
+
+#ifdef REFERENCE_SOLVER_ONLY
+// reference solver has no fixed size buffers, limits only
+// bound the problem sent by the gui
+quint32 const MAX_HORIZON = 100;
+quint32 const MAX_WAYPOINTS = 10;
+quint32 const MAX_OBS = 20;
+quint32 const MAX_CPOS = 40;
+
+TrajectoryProblem::TrajectoryProblem() : obstacles(), planes(),
+    waypoints() {
+    // only horizon, final time and limits affect reference solver
+    this->K = 20;
+    this->tf = 5.0;
+    this->a_min = 0;
+    this->a_max = 10.0;
+    this->v_max = 5.0;
+    this->v_max_slow = 0;
+    this->theta_max = 0;
+    this->j_max = 0;
+    this->delta = 0;
+    this->max_iter = 0;
+    this->lambda = 0;
+    this->ri_relax = 0;
+    this->rf_relax = 0;
+    this->wp_relax = 0;
+    this->trust_tau_weight = 0;
+    this->trust_delta_weight = 0;
+}
+#else
+// skyefly params have fixed size buffers
+quint32 const MAX_HORIZON = skyenet::MAX_HORIZON;
+quint32 const MAX_WAYPOINTS = skyenet::MAX_WAYPOINTS;
+quint32 const MAX_OBS = skyenet::MAX_OBS;
+quint32 const MAX_CPOS = skyenet::MAX_CPOS;
+
+TrajectoryProblem::TrajectoryProblem() : obstacles(), planes(),
+    waypoints() {
+    SkyeFlySolver::loadDefaults(this);
+}
+#endif
+
+TrajectoryInputs::TrajectoryInputs() : r_i(), v_i(), a_i(), r_f() {}
+
+TrajectoryInputs::TrajectoryInputs(QVector3D const &initial_pos,
+                                   QVector3D const &initial_vel,
+                                   QVector3D const &initial_acc,
+                                   QVector3D const &final_pos) :
+    r_i(), v_i(), a_i(), r_f() {
+    // set initial drone pos
+    QVector3D xyz_drone_pos = guiXyzToXyz(initial_pos);
+    this->r_i[0] = xyz_drone_pos.x();
+    this->r_i[1] = xyz_drone_pos.y();
+    this->r_i[2] = xyz_drone_pos.z();
+
+    // set initial drone vel
+    QVector3D xyz_drone_vel = guiXyzToXyz(initial_vel);
+    this->v_i[0] = xyz_drone_vel.x();
+    this->v_i[1] = xyz_drone_vel.y();
+    this->v_i[2] = xyz_drone_vel.z();
+
+    // set iniital drone accel
+    QVector3D xyz_drone_acc = guiXyzToXyz(initial_acc);
+    this->a_i[0] = xyz_drone_acc.x();
+    this->a_i[1] = xyz_drone_acc.y();
+    this->a_i[2] = xyz_drone_acc.z();
+
+    // set final pos
+    QVector3D xyz_final_pos = guiXyzToXyz(final_pos);
+    this->r_f[0] = xyz_final_pos.x();
+    this->r_f[1] = xyz_final_pos.y();
+    this->r_f[2] = xyz_final_pos.z();
+}
+
+TrajectorySolver *TrajectorySolver::create(SOLVER_BACKEND backend) {
+    switch (backend) {
+        case REFERENCE_SOLVER: {
+            return new ReferenceSolver();
+        }
+        case SKYEFLY_SOLVER:
+        default: {
+#ifdef REFERENCE_SOLVER_ONLY
+            return new ReferenceSolver();
+#else
+            return new SkyeFlySolver();
+#endif
+        }
+    }
+}
+
+}  // namespace optgui
@@ -8,7 +8,9 @@
 #include <QVBoxLayout>
 #include <QBoxLayout>
 #include <QHeaderView>
+#include <QHBoxLayout>
 
+#include "include/globals.h"
 #include "include/window/port_dialog/port_selector.h"
 
 namespace optgui {
@@ -36,6 +38,9 @@ PortDialog::PortDialog(QWidget *parent)
 PortDialog::~PortDialog() {
     delete this->ports_;
 
+    delete this->mux_toggle_;
+    delete this->mux_port_;
+
     this->layout()->removeWidget(this->port_table_);
     delete this->port_table_;
 
@@ -51,6 +56,13 @@ void PortDialog::fillTable(ConstraintModel *model) {
                             this->ports_);
 }
 
+quint16 PortDialog::getMuxPort() {
+    if (!this->mux_toggle_->isChecked()) {
+        return 0;
+    }
+    return this->mux_port_->value();
+}
+
 void PortDialog::resetTable() {
     // table takes ownership of pointers and deletes them
     this->port_table_->clearContents();
@@ -98,7 +110,24 @@ void PortDialog::initializeTable() {
     palette.setColor(QPalette::Base, background);
     this->setPalette(palette);
 
+    // Set single port selector, disabled by default
+    QWidget *mux_row = new QWidget(this);
+    mux_row->setLayout(new QHBoxLayout(mux_row));
+    mux_row->layout()->setContentsMargins(0, 0, 0, 0);
+    this->mux_toggle_ = new QCheckBox(tr("Single Port"), mux_row);
+    this->mux_toggle_->setToolTip(tr("Receive all telemetry on one port, "
+                                     "routed by object listening port"));
+    this->mux_port_ = new QSpinBox(mux_row);
+    this->mux_port_->setRange(1024, 65535);
+    this->mux_port_->setValue(INIT_MUX_PORT);
+    this->mux_port_->setEnabled(false);
+    connect(this->mux_toggle_, SIGNAL(toggled(bool)),
+            this->mux_port_, SLOT(setEnabled(bool)));
+    mux_row->layout()->addWidget(this->mux_toggle_);
+    mux_row->layout()->addWidget(this->mux_port_);
+
     // Add to layout
+    this->layout()->addWidget(mux_row);
     this->layout()->addWidget(this->drone_table_);
     this->layout()->addWidget(this->port_table_);
 }